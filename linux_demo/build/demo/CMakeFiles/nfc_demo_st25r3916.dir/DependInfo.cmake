@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/linux_demo/demo/Src/logger.c" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/logger.c.o" "gcc" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/logger.c.o.d"
+  "/root/repo/linux_demo/demo/Src/main.c" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/main.c.o" "gcc" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/main.c.o.d"
+  "/root/repo/linux_demo/demo/Src/rfal_analog_config_custom.c" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/rfal_analog_config_custom.c.o" "gcc" "demo/CMakeFiles/nfc_demo_st25r3916.dir/Src/rfal_analog_config_custom.c.o.d"
+  "/root/repo/st25r_demos/Src/demo_ce.c" "demo/CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_ce.c.o" "gcc" "demo/CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_ce.c.o.d"
+  "/root/repo/st25r_demos/Src/demo_polling.c" "demo/CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_polling.c.o" "gcc" "demo/CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_polling.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
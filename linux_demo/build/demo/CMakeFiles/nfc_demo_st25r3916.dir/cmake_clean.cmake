@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/logger.c.o"
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/logger.c.o.d"
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/main.c.o"
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/main.c.o.d"
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/rfal_analog_config_custom.c.o"
+  "CMakeFiles/nfc_demo_st25r3916.dir/Src/rfal_analog_config_custom.c.o.d"
+  "CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_ce.c.o"
+  "CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_ce.c.o.d"
+  "CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_polling.c.o"
+  "CMakeFiles/nfc_demo_st25r3916.dir/root/repo/st25r_demos/Src/demo_polling.c.o.d"
+  "nfc_demo_st25r3916"
+  "nfc_demo_st25r3916.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nfc_demo_st25r3916.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/linux_demo/platform/Src/pltf_event.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_event.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_event.c.o.d"
+  "/root/repo/linux_demo/platform/Src/pltf_gpio.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_gpio.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_gpio.c.o.d"
+  "/root/repo/linux_demo/platform/Src/pltf_instance.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_instance.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_instance.c.o.d"
+  "/root/repo/linux_demo/platform/Src/pltf_spi.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_spi.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_spi.c.o.d"
+  "/root/repo/linux_demo/platform/Src/pltf_timer.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_timer.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_timer.c.o.d"
+  "/root/repo/rfal/source/rfal_analogConfig.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_analogConfig.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_analogConfig.c.o.d"
+  "/root/repo/rfal/source/rfal_crc.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_crc.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_crc.c.o.d"
+  "/root/repo/rfal/source/rfal_dpo.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_dpo.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_dpo.c.o.d"
+  "/root/repo/rfal/source/rfal_iso15693_2.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_iso15693_2.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_iso15693_2.c.o.d"
+  "/root/repo/rfal/source/rfal_isoDep.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_isoDep.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_isoDep.c.o.d"
+  "/root/repo/rfal/source/rfal_nfc.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfc.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfc.c.o.d"
+  "/root/repo/rfal/source/rfal_nfcDep.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcDep.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcDep.c.o.d"
+  "/root/repo/rfal/source/rfal_nfca.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfca.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfca.c.o.d"
+  "/root/repo/rfal/source/rfal_nfcb.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcb.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcb.c.o.d"
+  "/root/repo/rfal/source/rfal_nfcf.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcf.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcf.c.o.d"
+  "/root/repo/rfal/source/rfal_nfcv.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcv.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcv.c.o.d"
+  "/root/repo/rfal/source/rfal_st25tb.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25tb.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25tb.c.o.d"
+  "/root/repo/rfal/source/rfal_st25xv.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25xv.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25xv.c.o.d"
+  "/root/repo/rfal/source/rfal_t1t.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t1t.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t1t.c.o.d"
+  "/root/repo/rfal/source/rfal_t2t.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t2t.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t2t.c.o.d"
+  "/root/repo/rfal/source/rfal_t4t.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t4t.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t4t.c.o.d"
+  "/root/repo/rfal/source/st25r3916/rfal_rfst25r3916.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/rfal_rfst25r3916.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/rfal_rfst25r3916.c.o.d"
+  "/root/repo/rfal/source/st25r3916/st25r3916.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916.c.o.d"
+  "/root/repo/rfal/source/st25r3916/st25r3916_aat.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_aat.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_aat.c.o.d"
+  "/root/repo/rfal/source/st25r3916/st25r3916_com.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_com.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_com.c.o.d"
+  "/root/repo/rfal/source/st25r3916/st25r3916_irq.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_irq.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_irq.c.o.d"
+  "/root/repo/rfal/source/st25r3916/st25r3916_led.c" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_led.c.o" "gcc" "rfal/st25r3916/CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_led.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,63 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_event.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_event.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_gpio.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_gpio.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_instance.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_instance.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_spi.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_spi.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_timer.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/__/__/platform/Src/pltf_timer.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_analogConfig.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_analogConfig.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_crc.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_crc.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_dpo.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_dpo.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_iso15693_2.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_iso15693_2.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_isoDep.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_isoDep.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfc.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfc.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcDep.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcDep.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfca.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfca.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcb.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcb.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcf.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcf.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcv.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_nfcv.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25tb.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25tb.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25xv.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_st25xv.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t1t.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t1t.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t2t.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t2t.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t4t.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/rfal_t4t.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/rfal_rfst25r3916.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/rfal_rfst25r3916.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_aat.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_aat.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_com.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_com.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_irq.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_irq.c.o.d"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_led.c.o"
+  "CMakeFiles/rfal_st25r3916.dir/root/repo/rfal/source/st25r3916/st25r3916_led.c.o.d"
+  "librfal_st25r3916.pdb"
+  "librfal_st25r3916.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rfal_st25r3916.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
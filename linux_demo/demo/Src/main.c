@@ -26,9 +26,6 @@
  */
 #include "platform.h"
 #include "demo.h"
-#include <pthread.h>
-#include <sys/time.h>
-#include <semaphore.h>
 #include <errno.h>
 
 /*
@@ -37,8 +34,9 @@
  ******************************************************************************
  */
 
-/* number of nanoseconds in a millisecond */
-#define NS_TO_MS (1000000U)
+/* Max time the main thread is suspended without any event (ms).
+   Interrupts and timer deadlines wake it up earlier */
+#define MAIN_IDLE_TOUT (500)
 
 /*
  ******************************************************************************
@@ -46,48 +44,32 @@
  ******************************************************************************
  */
 
-/* Semaphore used to suspend main thread until:
-   - either an interrupt occurs (on the IRQ_MCU GPIO)
-   - or a timer expires */
-sem_t rfal_sem;
-
-bool add_time(struct timespec* ts, struct timespec* delay, struct timespec* res)
-{
-    bool overflow = false;
-
-    res->tv_sec   = ts->tv_sec;
-    res->tv_nsec  = ts->tv_nsec;
-    res->tv_sec  += delay->tv_sec;
-    res->tv_nsec += delay->tv_nsec;
-
-    if (res->tv_nsec >= 1000000000)  /* nanoseconds must be in range [0 .. 999999999] */
-    {
-        res->tv_sec  += 1U;
-        res->tv_nsec -= 1000000000;
-        overflow = true;
-    }
-    return overflow;
-}
-
 int main(void)
 {
 	platformLog("Welcome to the ST25R3916 NFC Demo on Linux.\r\n");
 	platformLog("Scanning for NFC technologies...\r\n");
 
 	int ret = 0;
-	struct timespec sem_time;
-	struct timespec ts_delay;
-	struct timespec new_time;
 
 	setlinebuf(stdout);
 
 	/* Initialize the platform */
+	/* Work on the ST25R connected as defined in platform.h */
+	ret = pltf_instance_select(0U);
+	if (ret != ERR_NONE)
+		goto error;
 	/* Initialize GPIO */
 	ret = gpio_init();
 	if (ret != ERR_NONE)
 		goto error;
 	/* Initialize SPI */
 	ret = spi_init();
+	if (ret != ERR_NONE)
+		goto error;
+	/* Initialize the event loop suspending this thread until:
+	   - either an interrupt has been serviced by the interrupt thread
+	   - or a timer expires */
+	ret = event_loop_init();
 	if (ret != ERR_NONE)
 		goto error;
 	/* Initialize interrupt mechanism */
@@ -95,12 +77,6 @@ int main(void)
 	if (ret != ERR_NONE)
 		goto error;
 
-	/* Initialize the semaphore */
-	ret = sem_init(&rfal_sem, 0, 0);
-	if (ret != 0) {
-		goto error;
-	}
-
 	/* Initialize RFAL and run the demo */
 	/*
 	* in case the rfal initalization failed signal it by flashing all LED
@@ -126,28 +102,21 @@ int main(void)
 		platformDelay(ok ? 200U : 100U);
 	}
 
-	ts_delay.tv_sec  = 0;
-	ts_delay.tv_nsec = 500U * NS_TO_MS;
-
 	while(1)
 	{
 		demoCycle();
 		/* Call the demo cycle twice to move forward the RFAL state machine */
-		/* This avoids the timed semaphore to run into its timeout */
+		/* This avoids the event loop to run into its timeout */
 		demoCycle();
 
-		/* Lock Semaphore to suspend this thread */
-		clock_gettime(CLOCK_REALTIME, &sem_time);
-
-		add_time(&sem_time, &ts_delay, &new_time);
-
-		int err = sem_timedwait(&rfal_sem, &new_time);
-		if ( (err != 0) && (errno != ETIMEDOUT) ) {
-			platformLog("sem_timedwait error %d errno %d\r\n", err, errno);
+		/* Suspend this thread until an interrupt or a timer deadline */
+		int err = event_loop_wait(MAIN_IDLE_TOUT);
+		if (err < 0) {
+			platformLog("event_loop_wait error errno %d\r\n", errno);
 		}
 	}
 
-	sem_destroy(&rfal_sem);
+	event_loop_deinit();
 
 error:
 	return ret;
@@ -0,0 +1,149 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2020 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*! \file pltf_event.h
+ *
+ *  \author
+ *
+ *  \brief Event loop to suspend the application until the RFAL needs to run.
+ *
+ *  It multiplexes in one epoll set the ST25R interrupt notifications,
+ *  the platform timer deadlines and file descriptors of the application.
+ *
+ *  The ST25R interrupt is not serviced on the event loop: the interrupt
+ *  thread runs the ISR and then wakes up the loop. The RFAL blocking calls
+ *  made from the loop thread wait for the ISR to update the interrupt
+ *  status, so they rely on it running on another thread.
+ *
+ */
+
+#ifndef PLATFORM_EVENT_H
+#define PLATFORM_EVENT_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdint.h>
+#include "st_errno.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+#define EVENT_LOOP_MAX_FDS        16U   /*!< Max number of file descriptors on the event loop  */
+#define EVENT_LOOP_WAIT_FOREVER   (-1)  /*!< Wait without timeout                              */
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+/*! Handler called from event_loop_wait() when a file descriptor is ready */
+typedef void (*event_loop_handler)(int fd, uint32_t events, void *ctx);
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+/*!
+ *****************************************************************************
+ * \brief  Initialize the event loop
+ *
+ * This method creates the epoll set and registers the wake-up eventfd,
+ * signaled once the ST25R interrupt has been serviced, and the platform
+ * timer deadlines.
+ *
+ * \return ERR_IO   : Error creating the event loop
+ * \return ERR_NONE : No error
+ *****************************************************************************
+ */
+ReturnCode event_loop_init(void);
+
+/*!
+ *****************************************************************************
+ * \brief  Add an application file descriptor to the event loop
+ *
+ * \param[in] fd      : file descriptor to watch
+ * \param[in] events  : epoll events to watch (e.g. EPOLLIN)
+ * \param[in] handler : handler called from event_loop_wait() when fd is ready
+ * \param[in] ctx     : context passed to the handler
+ *
+ * \return ERR_WRONG_STATE : Event loop not initialized
+ * \return ERR_NOMEM       : No room for another file descriptor
+ * \return ERR_IO          : Error adding the file descriptor
+ * \return ERR_NONE        : No error
+ *****************************************************************************
+ */
+ReturnCode event_loop_add(int fd, uint32_t events, event_loop_handler handler, void *ctx);
+
+/*!
+ *****************************************************************************
+ * \brief  Remove an application file descriptor from the event loop
+ *
+ * \param[in] fd : file descriptor previously added
+ *
+ * \return ERR_PARAM : File descriptor not on the event loop
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode event_loop_remove(int fd);
+
+/*!
+ *****************************************************************************
+ * \brief  Wake up the event loop
+ *
+ * This method makes the pending or next event_loop_wait() return.
+ * It can be called from any thread, e.g. after servicing the ST25R interrupt.
+ *
+ *****************************************************************************
+ */
+void event_loop_wakeup(void);
+
+/*!
+ *****************************************************************************
+ * \brief  Wait for events
+ *
+ * This method suspends the calling thread until the event loop is woken up,
+ * a platform timer expires or an application file descriptor is ready,
+ * then calls the handlers of the ready file descriptors.
+ *
+ * \param[in] timeout : max time to wait in ms, EVENT_LOOP_WAIT_FOREVER to
+ *                      wait without timeout
+ *
+ * \return number of events handled, 0 on timeout, -1 on error
+ *****************************************************************************
+ */
+int event_loop_wait(int timeout);
+
+/*!
+ *****************************************************************************
+ * \brief  Release the event loop
+ *
+ *****************************************************************************
+ */
+void event_loop_deinit(void);
+
+#endif /* PLATFORM_EVENT_H */
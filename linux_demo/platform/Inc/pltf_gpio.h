@@ -39,6 +39,8 @@
  * INCLUDES
  ******************************************************************************
  */
+#include <stdint.h>
+#include <stdbool.h>
 #include "st_errno.h"
 
 /*
@@ -72,6 +74,7 @@ typedef enum {
  * to control GPIO pin from user space.
  * This method configures the GPIO line as interrupt pin with rising edge 
  * to receive interrupts from ST25R.
+ * The lines are the ones of the instance selected by the calling thread.
  *
  * \return ERR_IO	: GPIO is not successfuly configured as interrupt pin 
  * \return ERR_NONE	: No error
@@ -98,9 +101,12 @@ GPIO_PinState gpio_readpin(int port, int pin_no);
  * \brief  To initialize the interrupt mechanism in user space
  *  
  * This method starts a pthread that polls the interrupt line and call the ISR 
- * when there is an event (interrupt) on gpio line.
+ * when there is an event (interrupt) on gpio line, then wakes up the event
+ * loop. The ISR stays on this thread so that RFAL blocking calls made from
+ * the event loop thread can wait for it.
  * It provides the functionality to use a GPIO line to receive interrupts from 
  * ST25R in user space.
+ * The thread services the instance selected by the calling thread.
  *
  * \return ERR_IO	: Error in initializing interrupt mechanism 
  * \return ERR_NONE	: No error
@@ -174,4 +180,54 @@ void pltf_protect_worker(void);
  */
 void pltf_unprotect_worker(void); 
 
+/*! 
+ *****************************************************************************
+ * \brief  Signal the interrupt has been serviced
+ *  
+ * This method wakes up all threads blocked on pltf_irq_event_wait()
+ * 
+ *****************************************************************************
+ */
+void pltf_irq_event_signal(void);
+
+/*! 
+ *****************************************************************************
+ * \brief  Get interrupt event sequence
+ *  
+ * This method returns the number of times the interrupt has been serviced,
+ * to be read before checking the interrupt status and then passed to 
+ * pltf_irq_event_wait() so that no interrupt is missed
+ * 
+ * \return current interrupt event sequence
+ *****************************************************************************
+ */
+uint32_t pltf_irq_event_get(void);
+
+/*! 
+ *****************************************************************************
+ * \brief  Compute an interrupt wait deadline
+ *  
+ * \param[in]	tmo : timeout in ms, 0 for no timeout
+ * 
+ * \return absolute deadline on the monotonic clock, 0 for no timeout
+ *****************************************************************************
+ */
+uint64_t pltf_irq_event_deadline(uint32_t tmo);
+
+/*! 
+ *****************************************************************************
+ * \brief  Wait for the interrupt to be serviced
+ *  
+ * This method blocks the calling thread until the interrupt event sequence
+ * differs from \a seq or the deadline is reached
+ * 
+ * \param[in]	seq      : interrupt event sequence read before checking the status
+ * \param[in]	deadline : deadline given by pltf_irq_event_deadline()
+ * 
+ * \return false : deadline reached
+ * \return true  : interrupt serviced (or spurious wake-up)
+ *****************************************************************************
+ */
+bool pltf_irq_event_wait(uint32_t seq, uint64_t deadline);
+
 #endif /* PLATFORM_GPIO_H */
@@ -0,0 +1,154 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2020 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*! \file pltf_instance.h
+ *
+ *  \author
+ *
+ *  \brief ST25R front-end instances handled by one process.
+ *
+ *  Each instance is an ST25R connected on its own spidev and gpiochip pair.
+ *  The chip, transport and protocol state of the RFAL and of the platform
+ *  is kept per instance, and a thread works on the instance it has selected
+ *  with pltf_instance_select(). There is no default instance: a thread must
+ *  select one before any platform or RFAL call, single reader applications
+ *  select instance 0. A thread that did not select one fails an assertion,
+ *  or with NDEBUG logs an error and works on instance 0.
+ *
+ *  A given instance must be driven by one thread at a time (plus its
+ *  interrupt thread), different instances can run from independent threads.
+ *
+ */
+
+#ifndef PLATFORM_INSTANCE_H
+#define PLATFORM_INSTANCE_H
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include "st_errno.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+#define PLTF_MAX_INSTANCES        8U    /*!< Max number of ST25R handled by the process */
+#define PLTF_INSTANCE_NONE        0xFFU /*!< No instance selected by the thread         */
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+/*! Instance handle */
+typedef uint8_t pltf_instance;
+
+/*! Hardware connection of an instance */
+typedef struct
+{
+    const char *spiDevice;  /*!< spidev node the ST25R is connected to, e.g. "/dev/spidev0.0" */
+    uint8_t    gpioChip;    /*!< gpiochip number of the interrupt and LED lines                */
+    uint8_t    intPin;      /*!< Line offset of the ST25R interrupt                            */
+    bool       leds;        /*!< Drive the LEDs defined in platform.h from this instance        */
+} pltf_instance_config;
+
+/*
+ ******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************
+ */
+extern _Thread_local pltf_instance pltfCurInstance; /* Instance selected by the calling thread */
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+#define pltf_instance_get()       ((pltfCurInstance < PLTF_MAX_INSTANCES) ? pltfCurInstance : pltf_instance_unselected())  /*!< Instance selected by the calling thread */
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+/*!
+ *****************************************************************************
+ * \brief  Configure an instance
+ *
+ * This method sets the spidev and gpiochip pair of the given instance.
+ * It must be called before the platform initialization of the instance.
+ * Instance 0 defaults to the connection defined in platform.h, the platform
+ * initialization of any other instance fails until it is configured.
+ *
+ * \param[in] inst : instance to configure
+ * \param[in] cfg  : hardware connection, spiDevice must stay valid
+ *
+ * \return ERR_PARAM : Invalid instance or configuration
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode pltf_instance_configure(pltf_instance inst, const pltf_instance_config *cfg);
+
+/*!
+ *****************************************************************************
+ * \brief  Get the configuration of an instance
+ *
+ * \param[in] inst : instance
+ *
+ * \return the instance configuration, NULL if inst is invalid or not configured
+ *****************************************************************************
+ */
+const pltf_instance_config *pltf_instance_get_config(pltf_instance inst);
+
+/*!
+ *****************************************************************************
+ * \brief  Select the instance of the calling thread
+ *
+ * All the following platform and RFAL calls of the calling thread
+ * work on the given instance.
+ *
+ * \param[in] inst : instance to select
+ *
+ * \return ERR_PARAM : Invalid instance
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode pltf_instance_select(pltf_instance inst);
+
+/*!
+ *****************************************************************************
+ * \brief  Handle a thread working on the ST25R without selected instance
+ *
+ * Asserts, or with NDEBUG logs an error once per thread and falls back to
+ * instance 0 so that no per instance state is accessed out of bounds.
+ *
+ * \return the instance to work on
+ *****************************************************************************
+ */
+pltf_instance pltf_instance_unselected(void);
+
+#endif /* PLATFORM_INSTANCE_H */
@@ -37,8 +37,18 @@
  ******************************************************************************
  */
 #include <stdint.h>
+#include <stdbool.h>
 #include "st_errno.h"
 
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+#define SPI_BATCH_MAX_XFERS      64U      /*!< Max number of segments queued on a batch before it is flushed       */
+#define SPI_BATCH_BUF_LEN        1024U    /*!< Size of the staging buffer holding the Tx data of queued segments   */
+#define SPI_BATCH_MSG_MAX_LEN    4096U    /*!< Max bytes moved by one SPI_IOC_MESSAGE (spidev default bufsiz)      */
+
 /*
  ******************************************************************************
  * GLOBAL TYPES
@@ -65,6 +75,7 @@ typedef enum
  *  
  * This methods initialize SPI interface so that Linux host can use SPI interface
  * to communicate with ST25R.
+ * The spidev node is the one of the instance selected by the calling thread.
  *
  * \return ERR_IO   : SPI interface not initialized successfully
  * \return ERR_NONE : No error
@@ -84,7 +95,116 @@ ReturnCode spi_init(void);
  *****************************************************************************
  */
 /* function for full duplex SPI communication */
-HAL_statusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint8_t length);
+HAL_statusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t length);
+
+/*! 
+ *****************************************************************************
+ * \brief  Transmit then receive on a single chip select frame
+ *  
+ * This method transmits \a txData and then receives straight into \a rxData 
+ * as two chained transfers, chip select is kept asserted in between.
+ * Zeros are clocked out during the reception.
+ *
+ * \param[in]  txData   : data to transmit
+ * \param[in]  txLength : length of data to transmit
+ * \param[out] rxData   : location for the received data
+ * \param[in]  rxLength : length of data to receive
+ *
+ * \return HAL_ERROR : SPI not initialized or SPI error
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiTxThenRx(const uint8_t *txData, uint16_t txLength, uint8_t *rxData, uint16_t rxLength);
+
+/*! 
+ *****************************************************************************
+ * \brief  Set the SPI clock
+ *  
+ * This method sets the SPI clock used for short (register) transfers and
+ * for bulk (FIFO) transfers
+ *
+ * \param[in]  regFreq  : clock for register accesses in Hz
+ * \param[in]  bulkFreq : clock for FIFO transfers in Hz
+ *
+ * \return HAL_ERROR : SPI not initialized, invalid frequency or SPI error
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiSetFrequency(uint32_t regFreq, uint32_t bulkFreq);
+
+/*! 
+ *****************************************************************************
+ * \brief  Get the SPI clock
+ *  
+ * \param[out] regFreq  : clock for register accesses in Hz, NULL if not needed
+ * \param[out] bulkFreq : clock for FIFO transfers in Hz, NULL if not needed
+ *****************************************************************************
+ */
+void spiGetFrequency(uint32_t *regFreq, uint32_t *bulkFreq);
+
+/*! 
+ *****************************************************************************
+ * \brief  Open a SPI batch
+ *  
+ * This method opens a batch: subsequent segments queued with spiBatchAdd()
+ * are not transferred immediately but kept until spiBatchFlush() or
+ * spiBatchEnd() submit them all as a single SPI_IOC_MESSAGE(N).
+ * The caller must hold the communication lock for the whole batch.
+ *
+ * \return HAL_ERROR : SPI not initialized or a batch is already open
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiBatchBegin(void);
+
+/*! 
+ *****************************************************************************
+ * \brief  Queue a segment on the open SPI batch
+ *  
+ * This method queues one SPI segment. Tx data is copied to an internal 
+ * staging buffer so the caller's buffer may be reused right away. Rx data
+ * is scattered directly into \a rxData once the batch is flushed, hence
+ * \a rxData must remain valid until then.
+ * Consecutive segments belong to the same chip select frame until a segment
+ * is queued with \a csRelease set.
+ * When the batch is full the already completed frames are flushed.
+ *
+ * \param[in]  txData    : data to transmit, NULL to clock out zeros
+ * \param[out] rxData    : location for the received data, NULL to discard
+ * \param[in]  length    : segment length
+ * \param[in]  csRelease : true if chip select is released after this segment
+ *
+ * \return HAL_ERROR : No batch open, segment does not fit or SPI error
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiBatchAdd(const uint8_t *txData, uint8_t *rxData, uint16_t length, bool csRelease);
+
+/*! 
+ *****************************************************************************
+ * \brief  Flush the open SPI batch
+ *  
+ * This method submits all queued segments as one SPI message and keeps
+ * the batch open for further segments.
+ *
+ * \return HAL_ERROR : No batch open or SPI error
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiBatchFlush(void);
+
+/*! 
+ *****************************************************************************
+ * \brief  Close the open SPI batch
+ *  
+ * This method submits all queued segments as one SPI message and closes
+ * the batch.
+ *
+ * \return HAL_ERROR : No batch open or SPI error
+ * \return HAL_OK    : No error
+ *****************************************************************************
+ */
+HAL_statusTypeDef spiBatchEnd(void);
 
 /*! 
  *****************************************************************************
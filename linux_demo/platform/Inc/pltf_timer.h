@@ -52,6 +52,37 @@
 ******************************************************************************
 */
 uint32_t platformGetSysTick_linux();
+
+/*!
+ *****************************************************************************
+ * \brief  Get the System Tick in us
+ *
+ * \return the time on the monotonic clock in microseconds
+ *****************************************************************************
+ */
+uint64_t platformGetSysTickUs_linux(void);
+
+/*!
+ *****************************************************************************
+ * \brief  Get the System Tick in ns
+ *
+ * \return the time on the monotonic clock in nanoseconds
+ *****************************************************************************
+ */
+uint64_t platformGetSysTickNs_linux(void);
+
+/*!
+ *****************************************************************************
+ * \brief  Performs a delay in us
+ *
+ * This method sleeps with clock_nanosleep() till the given amount of
+ * microseconds has elapsed, spinning the last PLT_DELAY_SPIN_US to
+ * absorb the wake-up latency of the scheduler.
+ *
+ * \param[in]  us : delay in microseconds
+ *****************************************************************************
+ */
+void platformDelayUs_linux(uint32_t us);
  
  /*!
  *****************************************************************************
@@ -64,7 +95,7 @@ uint32_t platformGetSysTick_linux();
  *
  * \param[in]  time : time/duration in milliseconds for the timer
  *
- * \return u32 : The new timer's handle
+ * \return u32 : The new timer's handle, 0 if no timer could be allocated
  *****************************************************************************
  */
 uint32_t plfTimerCreate(uint32_t time);
@@ -92,6 +123,7 @@ bool plfTimerIsExpired(uint32_t timer);
  * \brief  Destroys the given timer
  *  
  * This method destroys the timer previously created.
+ * Destroying a timer already destroyed has no effect.
  * 
  * \see plfTimerCreate
  *
@@ -101,4 +133,47 @@ bool plfTimerIsExpired(uint32_t timer);
  */
 void plfTimerDestroy(uint32_t timer);
 
+/*!
+ *****************************************************************************
+ * \brief  Get the deadline of a Timer
+ *  
+ * This method returns the absolute time the timer expires at, on the
+ * CLOCK_MONOTONIC in ns, as the deadlines of pltf_irq_event_wait().
+ * 
+ * \see plfTimerCreate
+ *
+ * \param[in]  timer : the timer
+ *
+ * \return the timer deadline, 0 if the timer is not running
+ *****************************************************************************
+ */
+uint64_t plfTimerGetDeadline(uint32_t timer);
+
+/*!
+ *****************************************************************************
+ * \brief  Get the timer file descriptor
+ *  
+ * This method returns the timerfd armed for the nearest timer deadline,
+ * it becomes readable when a timer expires.
+ * 
+ * \see plfTimerProcess
+ *
+ * \return the timerfd, -1 if not available
+ *****************************************************************************
+ */
+int plfTimerGetFd(void);
+
+/*!
+ *****************************************************************************
+ * \brief  Process a timer expiration
+ *  
+ * This method acknowledges the expiration signaled on the timer file 
+ * descriptor and arms it for the next deadline.
+ * 
+ * \see plfTimerGetFd
+ *
+ *****************************************************************************
+ */
+void plfTimerProcess(void);
+
 #endif /* PLATFORM_TIMER_H */
@@ -66,6 +66,8 @@
 #include "pltf_timer.h"
 #include "pltf_spi.h"
 #include "pltf_gpio.h"
+#include "pltf_event.h"
+#include "pltf_instance.h"
 #include "st25r3916_irq.h"
 #include "logger.h"
 
@@ -112,23 +114,23 @@
 
 /* Number of GPIO lines to control */
 #define NB_GPIO_LINES                    7U
-extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO to control */
+extern int fd_GPIOs[PLTF_MAX_INSTANCES][NB_GPIO_LINES]; /* Array of file descriptors for each GPIO to control, per instance */
 
-#define PLATFORM_LED_A_PORT              (fd_GPIOs[2])
-#define PLATFORM_LED_B_PORT              (fd_GPIOs[3])
-#define PLATFORM_LED_F_PORT              (fd_GPIOs[4])
-#define PLATFORM_LED_V_PORT              (fd_GPIOs[5])
-#define PLATFORM_LED_AP2P_PORT           (fd_GPIOs[6])
+#define PLATFORM_LED_A_PORT              (fd_GPIOs[pltf_instance_get()][2])
+#define PLATFORM_LED_B_PORT              (fd_GPIOs[pltf_instance_get()][3])
+#define PLATFORM_LED_F_PORT              (fd_GPIOs[pltf_instance_get()][4])
+#define PLATFORM_LED_V_PORT              (fd_GPIOs[pltf_instance_get()][5])
+#define PLATFORM_LED_AP2P_PORT           (fd_GPIOs[pltf_instance_get()][6])
 
 #define LED_FIELD_Pin                    24
-#define LED_FIELD_GPIO_Port              (fd_GPIOs[1])
+#define LED_FIELD_GPIO_Port              (fd_GPIOs[pltf_instance_get()][1])
 
 #define ST25R_SS_PIN                                      /*!< GPIO pin used for ST25R SPI SS                    */
 #define ST25R_SS_PORT                                     /*!< GPIO port used for ST25R SPI SS port              */
 
 /* Set the GPIO pin number used as interrupt line to receive interrupts from ST25R */
 #define ST25R_INT_PIN               7                     /*!< GPIO pin used for ST25R External Interrupt        */
-#define ST25R_INT_PORT              (fd_GPIOs[0])         /*!< GPIO port used for ST25R External Interrupt       */
+#define ST25R_INT_PORT              (fd_GPIOs[pltf_instance_get()][0]) /*!< GPIO port used for ST25R External Interrupt */
 
 #ifdef LED_FIELD_Pin
 #define PLATFORM_LED_FIELD_PIN      LED_FIELD_Pin         /*!< GPIO pin used as field LED                        */
@@ -146,6 +148,11 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
 */
 
 #define ST25R_COM_SINGLETXRX                              /*!< Enable single SPI frame transmission */
+#define ST25R_COM_SHADOW                                  /*!< Enable shadow copy of ST25R config registers for read-modify-write */
+#define ST25R_IRQ_STATUS_ATOMIC                           /*!< Use C11 atomics for the interrupt status, no IrqStatus lock needed */
+
+#define ST25R_MAX_INSTANCES                       PLTF_MAX_INSTANCES                                      /*!< Number of ST25R handled by the RFAL, each with its own state */
+#define platformGetInstance()                     pltf_instance_get()                                     /*!< Instance (0..ST25R_MAX_INSTANCES-1) selected by the calling thread */
 
 #define platformProtectST25RComm()                pltf_protect_com()                                      /*!< Protect unique access to ST25R communication channel - IRQ disable on single thread environment (MCU) ; Mutex lock on a multi thread environment */
 #define platformUnprotectST25RComm()              pltf_unprotect_com()                                    /*!< Unprotect unique access to ST25R communication channel - IRQ enable on a single thread environment (MCU) ; Mutex unlock on a multi thread environment         */
@@ -156,6 +163,10 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
 #define platformProtectST25RIrqStatus()           pltf_protect_interrupt_status()                         /*!< Acquire the lock for safe access of RFAL interrupt status variable */
 #define platformUnprotectST25RIrqStatus()         pltf_unprotect_interrupt_status()                       /*!< Release the lock aquired for safe accessing of RFAL interrupt status variable */
 
+#define platformIrqEventGet()                     pltf_irq_event_get()                                    /*!< Get the sequence number of serviced interrupts                     */
+#define platformIrqEventDeadline(tmo)             pltf_irq_event_deadline(tmo)                            /*!< Compute the absolute deadline for the given timeout (ms), 0: none  */
+#define platformIrqEventWait(seq, deadline)       pltf_irq_event_wait(seq, deadline)                      /*!< Block until an interrupt is serviced after seq or the deadline     */
+
 #define platformIrqST25R3916SetCallback(cb)
 #define platformIrqST25R3916PinInitialize()
 
@@ -178,12 +189,23 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
 #define platformTimerCreate(t)                        plfTimerCreate(t)                                        /*!< Create a timer with the given time (ms)     */
 #define platformTimerIsExpired(t)                     plfTimerIsExpired(t)                                     /*!< Checks if the given timer is expired        */
 #define platformTimerDestroy(t)                       plfTimerDestroy(t)                                       /*!< Destroy a timer                             */
+#define platformTimerGetDeadline(t)                   plfTimerGetDeadline(t)                                   /*!< Deadline of a timer for platformIrqEventWait, 0: none */
 
 #define platformDelay(t)                              usleep((t)*1000U)                                        /*!< Performs a delay for the given time (ms)    */
+#define platformDelayUs(t)                            platformDelayUs_linux(t)                                 /*!< Performs a delay for the given time (us)    */
 
 #define platformGetSysTick()                          platformGetSysTick_linux()                               /*!< Get System Tick (1 tick = 1 ms)             */
+#define platformGetSysTickUs()                        platformGetSysTickUs_linux()                             /*!< Get System Tick in us                       */
+#define platformGetSysTickNs()                        platformGetSysTickNs_linux()                             /*!< Get System Tick in ns                       */
 
 #define platformSpiTxRx(txBuf, rxBuf, len)            spiTxRx(txBuf, rxBuf, len)                               /*!< SPI transceive                              */
+#define platformSpiSetFrequency(regHz, fifoHz)       spiSetFrequency(regHz, fifoHz)                           /*!< Set SPI clock for register/FIFO transfers   */
+#define platformSpiGetFrequency(regHz, fifoHz)       spiGetFrequency(regHz, fifoHz)                           /*!< Get SPI clock for register/FIFO transfers   */
+#define platformSpiTxThenRx(txBuf, txLen, rxBuf, rxLen) spiTxThenRx(txBuf, txLen, rxBuf, rxLen)             /*!< SPI transmit then receive on same CS frame  */
+#define platformSpiBatchBegin()                       spiBatchBegin()                                          /*!< Open a batch of SPI transfers               */
+#define platformSpiBatchAdd(txBuf, rxBuf, len, last)  spiBatchAdd(txBuf, rxBuf, len, last)                     /*!< Queue a SPI transfer, last releases CS      */
+#define platformSpiBatchFlush()                       spiBatchFlush()                                          /*!< Submit the queued SPI transfers             */
+#define platformSpiBatchEnd()                         spiBatchEnd()                                            /*!< Submit the queued transfers, close batch    */
 
 
 #define platformI2CTx(txBuf, len)                                                                              /*!< I2C Transmit                                */
@@ -205,6 +227,9 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
 #define RFAL_FEATURE_LISTEN_MODE               true       /*!< Enable/Disable RFAL support for Listen Mode                               */
 #define RFAL_FEATURE_WAKEUP_MODE               true       /*!< Enable/Disable RFAL support for the Wake-Up mode                          */
 #define RFAL_FEATURE_LOWPOWER_MODE             false      /*!< Enable/Disable RFAL support for the Low Power mode                        */
+#define RFAL_FEATURE_TX_PRESTAGE               true       /*!< Enable/Disable staging the transmit sequence while waiting for GT/FDT     */
+#define RFAL_FEATURE_HW_TIMERS                 true       /*!< Enable/Disable timing GT on the ST25R3916 GPT instead of a SW timer       */
+#define RFAL_FEATURE_PROFILER                  false      /*!< Enable/Disable the transceive latency profiler, see rfalGetProfStats()    */
 #define RFAL_FEATURE_NFCA                      true       /*!< Enable/Disable RFAL support for NFC-A (ISO14443A)                         */
 #define RFAL_FEATURE_NFCB                      true       /*!< Enable/Disable RFAL support for NFC-B (ISO14443B)                         */
 #define RFAL_FEATURE_NFCF                      true       /*!< Enable/Disable RFAL support for NFC-F (FeliCa)                            */
@@ -238,6 +263,14 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
  ******************************************************************************
  */
 
+#ifndef ST25R_MAX_INSTANCES
+    #define ST25R_MAX_INSTANCES                        1U /*!< Number of ST25R handled by the RFAL            */
+#endif /* ST25R_MAX_INSTANCES */
+
+#ifndef platformGetInstance
+    #define platformGetInstance()                      0U /*!< Instance selected by the caller                */
+#endif /* platformGetInstance */
+
 #ifndef platformProtectST25RIrqStatus
     #define platformProtectST25RIrqStatus()            /*!< Protect unique access to IRQ status var - IRQ disable on single thread environment (MCU) ; Mutex lock on a multi thread environment */
 #endif /* platformProtectST25RIrqStatus */
@@ -282,6 +315,18 @@ extern int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO t
     #define platformGetSysTick()                       /*!< Get System Tick (1 tick = 1 ms)              */
 #endif /* platformGetSysTick */                                                                          
                                                                                                          
+#ifndef platformGetSysTickUs
+    #define platformGetSysTickUs()                     ((uint64_t)platformGetSysTick() * 1000U) /*!< Get System Tick in us  */
+#endif /* platformGetSysTickUs */
+
+#ifndef platformGetSysTickNs
+    #define platformGetSysTickNs()                     ((uint64_t)platformGetSysTickUs() * 1000U) /*!< Get System Tick in ns  */
+#endif /* platformGetSysTickNs */
+
+#ifndef platformDelayUs
+    #define platformDelayUs( t )                       platformDelay( ((t) + 999U) / 1000U )   /*!< Delay rounded up to ms  */
+#endif /* platformDelayUs */
+
 #ifndef platformTimerDestroy                                                                             
     #define platformTimerDestroy( timer )              /*!< Stops and released the given timer           */
 #endif /* platformTimerDestroy */
@@ -0,0 +1,265 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2020 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*! \file pltf_event.c
+ *
+ *  \author
+ *
+ *  \brief Implementation of the event loop based on epoll, eventfd and the
+ *  platform timer's timerfd.
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "pltf_event.h"
+#include "pltf_timer.h"
+
+/*
+ ******************************************************************************
+ * DEFINES
+ ******************************************************************************
+ */
+/* Wake-up eventfd and timerfd are registered along with the application fds */
+#define EVENT_LOOP_MAX_ENTRIES    (EVENT_LOOP_MAX_FDS + 2U)
+
+/*
+ ******************************************************************************
+ * LOCAL TYPES
+ ******************************************************************************
+ */
+/* File descriptor registered on the event loop */
+typedef struct
+{
+    int                fd;        /* File descriptor, -1 if entry is free */
+    event_loop_handler handler;   /* Handler called when fd is ready      */
+    void               *ctx;      /* Context passed to the handler        */
+} event_loop_entry;
+
+/*
+ ******************************************************************************
+ * STATIC VARIABLES
+ ******************************************************************************
+ */
+static bool             isEventLoopInit = false;
+static int              epollFd = -1;
+static int              wakeupFd = -1;
+static event_loop_entry entries[EVENT_LOOP_MAX_ENTRIES];
+
+/*
+ ******************************************************************************
+ * GLOBAL AND HELPER FUNCTIONS
+ ******************************************************************************
+ */
+
+static void event_loop_wakeup_handler(int fd, uint32_t events, void *ctx)
+{
+    uint64_t count;
+
+    (void)events;
+    (void)ctx;
+
+    /* Consume all the wake-ups signaled so far */
+    (void)read(fd, &count, sizeof(count));
+}
+
+static void event_loop_timer_handler(int fd, uint32_t events, void *ctx)
+{
+    (void)fd;
+    (void)events;
+    (void)ctx;
+
+    plfTimerProcess();
+}
+
+static ReturnCode event_loop_register(int fd, uint32_t events, event_loop_handler handler, void *ctx)
+{
+    struct epoll_event ev;
+    uint32_t i;
+
+    for (i = 0; i < EVENT_LOOP_MAX_ENTRIES; i++) {
+        if (entries[i].fd < 0) {
+            break;
+        }
+    }
+    if (i >= EVENT_LOOP_MAX_ENTRIES) {
+        return ERR_NOMEM;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events   = events;
+    ev.data.ptr = &entries[i];
+
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        fprintf(stderr, "Error: adding fd %d to event loop (errno %d)\n", fd, errno);
+        return ERR_IO;
+    }
+
+    entries[i].fd      = fd;
+    entries[i].handler = handler;
+    entries[i].ctx     = ctx;
+
+    return ERR_NONE;
+}
+
+ReturnCode event_loop_init(void)
+{
+    ReturnCode ret;
+    uint32_t i;
+
+    if (isEventLoopInit) {
+        return ERR_NONE;
+    }
+
+    for (i = 0; i < EVENT_LOOP_MAX_ENTRIES; i++) {
+        entries[i].fd = -1;
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        fprintf(stderr, "Error: epoll creation (errno %d)\n", errno);
+        return ERR_IO;
+    }
+
+    wakeupFd = eventfd(0, (EFD_NONBLOCK | EFD_CLOEXEC));
+    if (wakeupFd < 0) {
+        fprintf(stderr, "Error: eventfd creation (errno %d)\n", errno);
+        ret = ERR_IO;
+        goto error;
+    }
+
+    ret = event_loop_register(wakeupFd, EPOLLIN, event_loop_wakeup_handler, NULL);
+    if (ret != ERR_NONE) {
+        goto error;
+    }
+
+    /* Platform timers wake up the loop on the nearest deadline */
+    if (plfTimerGetFd() >= 0) {
+        ret = event_loop_register(plfTimerGetFd(), EPOLLIN, event_loop_timer_handler, NULL);
+        if (ret != ERR_NONE) {
+            goto error;
+        }
+    }
+
+    isEventLoopInit = true;
+    return ERR_NONE;
+
+error:
+    event_loop_deinit();
+    return ret;
+}
+
+ReturnCode event_loop_add(int fd, uint32_t events, event_loop_handler handler, void *ctx)
+{
+    if (!isEventLoopInit) {
+        return ERR_WRONG_STATE;
+    }
+
+    if ((fd < 0) || (handler == NULL)) {
+        return ERR_PARAM;
+    }
+
+    return event_loop_register(fd, events, handler, ctx);
+}
+
+ReturnCode event_loop_remove(int fd)
+{
+    uint32_t i;
+
+    for (i = 0; i < EVENT_LOOP_MAX_ENTRIES; i++) {
+        if ((entries[i].fd == fd) && (fd >= 0)) {
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, NULL);
+            entries[i].fd = -1;
+            return ERR_NONE;
+        }
+    }
+
+    return ERR_PARAM;
+}
+
+void event_loop_wakeup(void)
+{
+    uint64_t one = 1;
+
+    if (wakeupFd >= 0) {
+        (void)write(wakeupFd, &one, sizeof(one));
+    }
+}
+
+int event_loop_wait(int timeout)
+{
+    struct epoll_event events[EVENT_LOOP_MAX_ENTRIES];
+    event_loop_entry *entry;
+    int nfds;
+    int i;
+
+    if (!isEventLoopInit) {
+        return -1;
+    }
+
+    nfds = epoll_wait(epollFd, events, EVENT_LOOP_MAX_ENTRIES, timeout);
+    if (nfds < 0) {
+        return ((errno == EINTR) ? 0 : -1);
+    }
+
+    for (i = 0; i < nfds; i++) {
+        entry = events[i].data.ptr;
+
+        /* Entry may have been removed by a previous handler */
+        if (entry->fd >= 0) {
+            entry->handler(entry->fd, events[i].events, entry->ctx);
+        }
+    }
+
+    return nfds;
+}
+
+void event_loop_deinit(void)
+{
+    uint32_t i;
+
+    isEventLoopInit = false;
+
+    for (i = 0; i < EVENT_LOOP_MAX_ENTRIES; i++) {
+        entries[i].fd = -1;
+    }
+
+    if (wakeupFd >= 0) {
+        close(wakeupFd);
+        wakeupFd = -1;
+    }
+
+    if (epollFd >= 0) {
+        close(epollFd);
+        epollFd = -1;
+    }
+}
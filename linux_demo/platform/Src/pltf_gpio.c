@@ -38,16 +38,18 @@
 #include <fcntl.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 #include <sys/stat.h>
 #include <linux/gpio.h>
 #include <sys/ioctl.h>
 
-#include <semaphore.h>
 #include "platform.h"
-
-/* Extern semaphore to signal once an interrupt occurs */
-extern sem_t rfal_sem;
+#include "pltf_event.h"
 
 /*
  ******************************************************************************
@@ -63,12 +65,19 @@ extern sem_t rfal_sem;
  * STATIC VARIABLES
  ******************************************************************************
  */
-static bool isGPIOInit = false;
+/* GPIO context of an instance */
+typedef struct
+{
+    bool            isGPIOInit;
+    pthread_mutex_t lock;
+    pthread_mutex_t lockWorker;
+    /* Incremented each time the interrupt has been serviced, waiters sleep on it */
+    _Atomic uint32_t irqEventSeq;
+} gpioInstance;
 
-int fd_GPIOs[NB_GPIO_LINES]; /* Array of file descriptors for each GPIO to control */
+static gpioInstance gpioInst[PLTF_MAX_INSTANCES];
 
-static pthread_mutex_t lock;
-static pthread_mutex_t lockWorker;
+int fd_GPIOs[PLTF_MAX_INSTANCES][NB_GPIO_LINES]; /* Array of file descriptors for each GPIO to control, per instance */
 
 /*
  ******************************************************************************
@@ -119,14 +128,21 @@ static int gpio_get_linehandle(int fd_gpiochip, int direction, int pin_no)
 
 ReturnCode gpio_init(void)
 {
+    gpioInstance *gpio = &gpioInst[pltf_instance_get()];
+    const pltf_instance_config *cfg = pltf_instance_get_config(pltf_instance_get());
     int ret = 0;
     char gpiochip_file[SIZE];
 
-    if (isGPIOInit) {
+    if (gpio->isGPIOInit) {
         return ERR_NONE;
     }
 
-    sprintf(gpiochip_file, "/dev/gpiochip%d", ST25R_INT_PORT); /* Open /dev/gpiochip0 */
+    if (cfg == NULL) {
+        fprintf(stderr, "No gpiochip configured for instance %d\n", pltf_instance_get());
+        return ERR_WRONG_STATE;
+    }
+
+    sprintf(gpiochip_file, "/dev/gpiochip%d", cfg->gpioChip); /* Open /dev/gpiochipx of this instance */
     int fd = open(gpiochip_file, O_RDONLY);
     if (fd < 0) {
         ret = -errno;
@@ -134,40 +150,45 @@ ReturnCode gpio_init(void)
         return ret;
     }
 
-    /* Initialize file descriptor for each GPIO used by the platform */
-    ST25R_INT_PORT          = gpio_get_lineevent(fd, ST25R_INT_PIN);
-    PLATFORM_LED_FIELD_PORT = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_FIELD_PIN);
-    PLATFORM_LED_A_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_A_PIN);
-    PLATFORM_LED_B_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_B_PIN);
-    PLATFORM_LED_F_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_F_PIN);
-    PLATFORM_LED_V_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_V_PIN);
-    PLATFORM_LED_AP2P_PORT  = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_AP2P_PIN);
+    /* Initialize file descriptor for each GPIO used by the platform, LEDs only on the instance driving them */
+    for (uint32_t i = 0U; i < NB_GPIO_LINES; i++) {
+        fd_GPIOs[pltf_instance_get()][i] = -1;
+    }
+    ST25R_INT_PORT = gpio_get_lineevent(fd, cfg->intPin);
+    if (cfg->leds) {
+        PLATFORM_LED_FIELD_PORT = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_FIELD_PIN);
+        PLATFORM_LED_A_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_A_PIN);
+        PLATFORM_LED_B_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_B_PIN);
+        PLATFORM_LED_F_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_F_PIN);
+        PLATFORM_LED_V_PORT     = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_V_PIN);
+        PLATFORM_LED_AP2P_PORT  = gpio_get_linehandle(fd, GPIOHANDLE_REQUEST_OUTPUT, PLATFORM_LED_AP2P_PIN);
+    }
 
     /* Close /dev/gpiochipx */
     close(fd);
 
     /* Check each file descriptor is initialized properly */
-    for (int i = 0; i < NB_GPIO_LINES; i++)
+    for (uint32_t i = 0U; i < (cfg->leds ? NB_GPIO_LINES : 1U); i++)
     {
-        if (fd_GPIOs[i] < 0) {
+        if (fd_GPIOs[pltf_instance_get()][i] < 0) {
             fprintf(stderr, "GPIO init failed\n");
             return ERR_INVALID_HANDLE;
         }
     }
 
-    ret = pthread_mutex_init(&lock, NULL);
+    ret = pthread_mutex_init(&gpio->lock, NULL);
     if (ret != 0) {
         fprintf(stderr, "Failed to initialize mutex protecting interrupt status\n");
         return ret;
     }
     
-    ret = pthread_mutex_init(&lockWorker, NULL);
+    ret = pthread_mutex_init(&gpio->lockWorker, NULL);
     if (ret != 0) {
         fprintf(stderr, "Failed to initialize mutex protecting worker\n");
         return ret;
     }
 
-    isGPIOInit = true;
+    gpio->isGPIOInit = true;
     return ERR_NONE;
 }
 
@@ -177,13 +198,18 @@ GPIO_PinState gpio_readpin(int port, int pin_no)
     struct gpiohandle_data data;
 
     /* First check whether GPIOInit is done */
-    if (!isGPIOInit) {
+    if (!gpioInst[pltf_instance_get()].isGPIOInit) {
         ReturnCode ret = gpio_init();
         if (ret != ERR_NONE) {
             return GPIO_PIN_RESET;
         }
     }
 
+    /* Line not used by this instance */
+    if (port < 0) {
+        return GPIO_PIN_RESET;
+    }
+
     /* The port is used to contain the file descriptor of a given pin! */
     /* So use the port for ioctl */
     int ret = ioctl(port, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &data);
@@ -197,12 +223,15 @@ GPIO_PinState gpio_readpin(int port, int pin_no)
     return state;
 }
 
-void* pthread_func()
+void* pthread_func(void *arg)
 {
     struct gpioevent_data event;
 
+    /* The interrupt thread services the instance it has been created for */
+    pltf_instance_select((pltf_instance)(uintptr_t)arg);
+
     /* First check whether GPIOInit is done */
-    if (!isGPIOInit) {
+    if (!gpioInst[pltf_instance_get()].isGPIOInit) {
         fprintf(stderr, "GPIO is not initialized\n");
         return NULL;
     }
@@ -217,8 +246,11 @@ void* pthread_func()
         /* Call RFAL Isr */
         platformIsr();
 
-        /* Unlock Semaphore */
-        sem_post(&rfal_sem);
+        /* Wake up threads waiting for an interrupt */
+        pltf_irq_event_signal();
+
+        /* Wake up the event loop to run the worker */
+        event_loop_wakeup();
     }
 
     return NULL;
@@ -230,8 +262,8 @@ ReturnCode interrupt_init(void)
     struct sched_param params;
     int ret;
 
-    /* Create a pthread polling for interrupt */
-    ret = pthread_create(&intr_thread, NULL, pthread_func, NULL);
+    /* Create a pthread polling for interrupt of the calling thread's instance */
+    ret = pthread_create(&intr_thread, NULL, pthread_func, (void *)(uintptr_t)pltf_instance_get());
     if (ret) {
         fprintf(stderr, "Error: poll thread creation %d\n", ret);
         return ERR_IO;
@@ -253,13 +285,18 @@ void gpio_set_value(int port, int pin_no, uint8_t value)
     struct gpiohandle_data data;
 
     /* First check whether GPIOInit is done */
-    if (!isGPIOInit) {
+    if (!gpioInst[pltf_instance_get()].isGPIOInit) {
         ReturnCode ret = gpio_init();
         if (ret != ERR_NONE) {
             return;
         }
     }
 
+    /* Line not used by this instance, e.g. LEDs */
+    if (port < 0) {
+        return;
+    }
+
     memset(&data, 0, sizeof(data));
     data.values[0] = (value == GPIO_PIN_RESET ? GPIO_PIN_RESET : GPIO_PIN_SET);
 
@@ -283,20 +320,63 @@ void gpio_clear(int port, int pin_no)
 
 void pltf_protect_interrupt_status(void)
 {
-    pthread_mutex_lock(&lock);
+    pthread_mutex_lock(&gpioInst[pltf_instance_get()].lock);
 }
 
 void pltf_unprotect_interrupt_status(void)
 {
-    pthread_mutex_unlock(&lock);
+    pthread_mutex_unlock(&gpioInst[pltf_instance_get()].lock);
 }
 
 void pltf_protect_worker(void)
 {
-    pthread_mutex_lock(&lockWorker);
+    pthread_mutex_lock(&gpioInst[pltf_instance_get()].lockWorker);
 }
 
 void pltf_unprotect_worker(void)
 {
-    pthread_mutex_unlock(&lockWorker);
-}
\ No newline at end of file
+    pthread_mutex_unlock(&gpioInst[pltf_instance_get()].lockWorker);
+}
+
+void pltf_irq_event_signal(void)
+{
+    _Atomic uint32_t *seq = &gpioInst[pltf_instance_get()].irqEventSeq;
+
+    atomic_fetch_add_explicit(seq, 1U, memory_order_release);
+    syscall(SYS_futex, seq, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+}
+
+uint32_t pltf_irq_event_get(void)
+{
+    return atomic_load_explicit(&gpioInst[pltf_instance_get()].irqEventSeq, memory_order_acquire);
+}
+
+uint64_t pltf_irq_event_deadline(uint32_t tmo)
+{
+    struct timespec ts;
+
+    /* No timeout: wait forever */
+    if (tmo == 0U) {
+        return 0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec + ((uint64_t)tmo * 1000000ULL));
+}
+
+bool pltf_irq_event_wait(uint32_t seq, uint64_t deadline)
+{
+    struct timespec ts;
+    long ret;
+
+    ts.tv_sec  = (time_t)(deadline / 1000000000ULL);
+    ts.tv_nsec = (long)(deadline % 1000000000ULL);
+
+    /* Sleep while no interrupt has been serviced since seq was read, deadline is absolute on CLOCK_MONOTONIC */
+    ret = syscall(SYS_futex, &gpioInst[pltf_instance_get()].irqEventSeq, FUTEX_WAIT_BITSET_PRIVATE, seq, ((deadline == 0U) ? NULL : &ts), NULL, FUTEX_BITSET_MATCH_ANY);
+    if ((ret != 0) && (errno == ETIMEDOUT)) {
+        return false;
+    }
+
+    return true;
+}
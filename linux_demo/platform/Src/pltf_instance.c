@@ -0,0 +1,109 @@
+/******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2020 STMicroelectronics</center></h2>
+  *
+  * Licensed under ST MYLIBERTY SOFTWARE LICENSE AGREEMENT (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/myliberty
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied,
+  * AND SPECIFICALLY DISCLAIMING THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+******************************************************************************/
+
+/*! \file pltf_instance.c
+ *
+ *  \author
+ *
+ *  \brief Implementation of the ST25R instance selection.
+ *
+ */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "platform.h"
+#include "pltf_instance.h"
+
+/*
+ ******************************************************************************
+ * STATIC VARIABLES
+ ******************************************************************************
+ */
+/* Instance 0 is the ST25R connected on /dev/spidev0.0 as defined in platform.h */
+static pltf_instance_config instConfig[PLTF_MAX_INSTANCES] = {
+    { "/dev/spidev0.0", 0U, ST25R_INT_PIN, true },
+};
+
+/* Instances with a hardware connection, only instance 0 has a default one */
+static bool instConfigured[PLTF_MAX_INSTANCES] = { true };
+
+/*
+ ******************************************************************************
+ * GLOBAL VARIABLES
+ ******************************************************************************
+ */
+_Thread_local pltf_instance pltfCurInstance = PLTF_INSTANCE_NONE;
+
+/*
+ ******************************************************************************
+ * GLOBAL AND HELPER FUNCTIONS
+ ******************************************************************************
+ */
+ReturnCode pltf_instance_configure(pltf_instance inst, const pltf_instance_config *cfg)
+{
+    if ((inst >= PLTF_MAX_INSTANCES) || (cfg == NULL) || (cfg->spiDevice == NULL)) {
+        return ERR_PARAM;
+    }
+
+    instConfig[inst] = *cfg;
+    instConfigured[inst] = true;
+    return ERR_NONE;
+}
+
+const pltf_instance_config *pltf_instance_get_config(pltf_instance inst)
+{
+    if ((inst >= PLTF_MAX_INSTANCES) || !instConfigured[inst]) {
+        return NULL;
+    }
+
+    return &instConfig[inst];
+}
+
+ReturnCode pltf_instance_select(pltf_instance inst)
+{
+    if (inst >= PLTF_MAX_INSTANCES) {
+        return ERR_PARAM;
+    }
+
+    pltfCurInstance = inst;
+    return ERR_NONE;
+}
+
+pltf_instance pltf_instance_unselected(void)
+{
+    static _Thread_local bool logged = false;
+
+    assert(false && "pltf_instance_select() not called by this thread");
+
+    if (!logged) {
+        fprintf(stderr, "Error: thread working on the ST25R without selected instance, using instance 0\n");
+        logged = true;
+    }
+
+    return 0U;
+}
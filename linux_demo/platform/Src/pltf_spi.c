@@ -39,6 +39,7 @@
 #include <sys/ioctl.h>
 #include <pthread.h>
 #include "pltf_spi.h"
+#include "pltf_instance.h"
 
 
 /*
@@ -49,19 +50,51 @@
 #define SPI_MODE_CONFIG      SPI_MODE_1
 #define SPI_BITS_PER_WORD    8
 #define SPI_MAX_FREQ         6000000    /* for VDD_IO = 3.3V */
+#define SPI_BULK_MIN_LEN     16U        /* Transfers from this length on use the bulk (FIFO) clock */
 #define ARRAY_SIZE(a)        (sizeof(a) / sizeof(a[0]))
+#define SPI_BATCH_NO_TX      0xFFFFU    /* Segment without Tx data */
+
+/*
+ ******************************************************************************
+ * LOCAL TYPES
+ ******************************************************************************
+ */
+/* Segment queued on a SPI batch */
+typedef struct
+{
+    uint16_t txOff;      /* Offset of the Tx data in the staging buffer */
+    uint8_t  *rxData;    /* Location for the received data              */
+    uint16_t len;        /* Segment length                              */
+    bool     csRelease;  /* Release chip select after this segment      */
+} spiBatchSeg;
 
 /*
  ******************************************************************************
  * STATIC VARIABLES
  ******************************************************************************
  */
-/* ST25R is connected with Linux host's SPI port /dev/spidev0.0 */
-static const char *device = "/dev/spidev0.0";
-static int fd = 0;
-static int isSPIInit = 0;
-/* Lock to serialize SPI communication */
-static pthread_mutex_t lockCom;
+/* SPI context of an instance, instance 0 is connected with Linux host's SPI port /dev/spidev0.0 */
+typedef struct
+{
+    int             fd;
+    int             isSPIInit;
+    /* Lock to serialize SPI communication */
+    pthread_mutex_t lockCom;
+    /* SPI clock for short register accesses and for bulk FIFO transfers */
+    uint32_t        spiRegFreq;
+    uint32_t        spiBulkFreq;
+
+    /* SPI batch context */
+    bool            batchOpen;
+    spiBatchSeg     batchSegs[SPI_BATCH_MAX_XFERS];
+    uint8_t         batchBuf[SPI_BATCH_BUF_LEN];
+    uint16_t        batchNbSegs;      /* Number of queued segments                      */
+    uint16_t        batchFrameStart;  /* First segment of the frame not yet completed   */
+    uint16_t        batchBufLen;      /* Bytes used on the staging buffer               */
+    uint32_t        batchMsgLen;      /* Bytes moved by the queued segments             */
+} spiInstance;
+
+static spiInstance spiInst[PLTF_MAX_INSTANCES];
 
 /*
  ******************************************************************************
@@ -70,47 +103,61 @@ static pthread_mutex_t lockCom;
  */
 ReturnCode spi_init(void)
 {
+    spiInstance *spi = &spiInst[pltf_instance_get()];
     int ret = 0;
     uint32_t mode = SPI_MODE_CONFIG;
     uint8_t bitsperword = SPI_BITS_PER_WORD;
     uint32_t speed = SPI_MAX_FREQ;
+    const pltf_instance_config *cfg = pltf_instance_get_config(pltf_instance_get());
+
+    if (cfg == NULL) {
+        printf("Error: no spi device configured for instance %d\n", pltf_instance_get());
+        return ERR_WRONG_STATE;
+    }
 
-    fd = open(device, O_RDWR);
-    if (fd < 0) {
-        printf("Error: spi device open = %d\n", fd);
-        ret = fd;
+    spi->fd = open(cfg->spiDevice, O_RDWR);
+    if (spi->fd < 0) {
+        printf("Error: spi device open = %d\n", spi->fd);
+        ret = spi->fd;
         goto error;
     }
 
     /* set spi mode */
-    ret = ioctl(fd, SPI_IOC_WR_MODE32, &mode);
+    ret = ioctl(spi->fd, SPI_IOC_WR_MODE32, &mode);
     if (ret < 0) {
         printf("Error: SPI mode setting\n");
         goto error;
     }
 
     /* set spi bits per word */
-    ret = ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bitsperword);
+    ret = ioctl(spi->fd, SPI_IOC_WR_BITS_PER_WORD, &bitsperword);
      if (ret < 0) {
         printf("Error: setting spi bitsperword\n");
         goto error;
     }
 
     /* set spi frequency */
-    ret = ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
+    ret = ioctl(spi->fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
     if (ret < 0) {
         printf("Error: setting SPI frequency\n");
         goto error;
     }
 
-    ret = pthread_mutex_init(&lockCom, NULL);
+    /* Recursive so that a batch can hold the lock across several accesses */
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    ret = pthread_mutex_init(&spi->lockCom, &attr);
+    pthread_mutexattr_destroy(&attr);
     if (ret != 0)
     {
         printf("Error: mutex init to protect SPI communication is failed\n");
         goto error;
     }
 
-    isSPIInit = 1;
+    spi->spiRegFreq  = SPI_MAX_FREQ;
+    spi->spiBulkFreq = SPI_MAX_FREQ;
+    spi->isSPIInit   = 1;
     return ERR_NONE;
 
 error:
@@ -118,31 +165,65 @@ error:
 }
 
 
-HAL_statusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint8_t length)
+static void spiSetTransfer(struct spi_ioc_transfer *transfer, const uint8_t *txData, uint8_t *rxData, uint16_t length, bool csChange)
+{
+    const spiInstance *spi = &spiInst[pltf_instance_get()];
+
+    memset(transfer, 0, sizeof(struct spi_ioc_transfer));
+
+    if (txData)
+        transfer->tx_buf = (unsigned long) txData;
+    if (rxData)
+        transfer->rx_buf = (unsigned long) rxData;
+    transfer->len           = (unsigned int) length;
+    transfer->speed_hz      = ((length >= SPI_BULK_MIN_LEN) ? spi->spiBulkFreq : spi->spiRegFreq);
+    transfer->bits_per_word = SPI_BITS_PER_WORD;
+    transfer->delay_usecs   = 0;
+    transfer->cs_change     = (csChange ? 1 : 0);
+}
+
+
+HAL_statusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint16_t length)
 {  
+    spiInstance *spi = &spiInst[pltf_instance_get()];
     int ret = 0;
-    int i;
 
     /* check if SPI init is done */
-    if (!isSPIInit) {
+    if (!spi->isSPIInit) {
         printf(" error: spi is used for communication before its initialization\n");
         return    HAL_ERROR;
     }
 
     struct spi_ioc_transfer transfer;
-    memset(&transfer, 0, sizeof(struct spi_ioc_transfer));
+    spiSetTransfer(&transfer, txData, rxData, length, false);
 
-    if (txData)
-        transfer.tx_buf = (unsigned long) txData;
-    if (rxData)
-        transfer.rx_buf = (unsigned long) rxData;
-    transfer.len        = (unsigned int) length;
-    transfer.speed_hz   = SPI_MAX_FREQ;
-    transfer.bits_per_word = SPI_BITS_PER_WORD;
-    transfer.delay_usecs   = 0;
-    transfer.cs_change = 0;
-
-    ret = ioctl(fd, SPI_IOC_MESSAGE(1), &transfer);
+    ret = ioctl(spi->fd, SPI_IOC_MESSAGE(1), &transfer);
+    if (ret < 0) {
+        printf("Error: SPI error in data transfer=%d\n",ret);
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}
+
+
+HAL_statusTypeDef spiTxThenRx(const uint8_t *txData, uint16_t txLength, uint8_t *rxData, uint16_t rxLength)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+    struct spi_ioc_transfer transfers[2];
+    int ret = 0;
+
+    /* check if SPI init is done */
+    if (!spi->isSPIInit) {
+        printf(" error: spi is used for communication before its initialization\n");
+        return    HAL_ERROR;
+    }
+
+    /* Both segments on the same chip select: Rx segment clocks out zeros */
+    spiSetTransfer(&transfers[0], txData, NULL, txLength, false);
+    spiSetTransfer(&transfers[1], NULL, rxData, rxLength, false);
+
+    ret = ioctl(spi->fd, SPI_IOC_MESSAGE(2), transfers);
     if (ret < 0) {
         printf("Error: SPI error in data transfer=%d\n",ret);
         return HAL_ERROR;
@@ -151,13 +232,195 @@ HAL_statusTypeDef spiTxRx(const uint8_t *txData, uint8_t *rxData, uint8_t length
     return HAL_OK;
 }
 
+
+HAL_statusTypeDef spiSetFrequency(uint32_t regFreq, uint32_t bulkFreq)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+    uint32_t speed = ((regFreq > bulkFreq) ? regFreq : bulkFreq);
+    int ret = 0;
+
+    if (!spi->isSPIInit || (regFreq == 0U) || (bulkFreq == 0U)) {
+        return HAL_ERROR;
+    }
+
+    /* The device max speed caps the speed of every transfer */
+    ret = ioctl(spi->fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed);
+    if (ret < 0) {
+        printf("Error: setting SPI frequency\n");
+        return HAL_ERROR;
+    }
+
+    spi->spiRegFreq  = regFreq;
+    spi->spiBulkFreq = bulkFreq;
+
+    return HAL_OK;
+}
+
+
+void spiGetFrequency(uint32_t *regFreq, uint32_t *bulkFreq)
+{
+    const spiInstance *spi = &spiInst[pltf_instance_get()];
+
+    if (regFreq)
+        *regFreq = spi->spiRegFreq;
+    if (bulkFreq)
+        *bulkFreq = spi->spiBulkFreq;
+}
+
+
+/* Submits the completed frames (first nbSegs segments) as one message and moves the remaining to the front */
+static HAL_statusTypeDef spiBatchSubmit(uint16_t nbSegs)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+    struct spi_ioc_transfer transfers[SPI_BATCH_MAX_XFERS];
+    HAL_statusTypeDef status = HAL_OK;
+    uint16_t bufUsed = 0;
+    uint16_t i;
+    int ret;
+
+    if (nbSegs > 0U) {
+        for (i = 0; i < nbSegs; i++) {
+            spiBatchSeg *seg = &spi->batchSegs[i];
+
+            /* On the last transfer cs_change would keep CS asserted after the message */
+            spiSetTransfer(&transfers[i], ((seg->txOff != SPI_BATCH_NO_TX) ? &spi->batchBuf[seg->txOff] : NULL),
+                           seg->rxData, seg->len, ((i < (nbSegs - 1U)) && seg->csRelease));
+
+            if (seg->txOff != SPI_BATCH_NO_TX) {
+                bufUsed = (uint16_t)(seg->txOff + seg->len);
+            }
+        }
+
+        ret = ioctl(spi->fd, SPI_IOC_MESSAGE(nbSegs), transfers);
+        if (ret < 0) {
+            printf("Error: SPI error in batch transfer=%d\n", ret);
+            status = HAL_ERROR;
+        }
+    }
+
+    /* Keep the segments of a frame not yet completed */
+    spi->batchMsgLen = 0;
+    for (i = nbSegs; i < spi->batchNbSegs; i++) {
+        spiBatchSeg *seg = &spi->batchSegs[i - nbSegs];
+
+        *seg = spi->batchSegs[i];
+        if (seg->txOff != SPI_BATCH_NO_TX) {
+            seg->txOff = (uint16_t)(seg->txOff - bufUsed);
+        }
+        spi->batchMsgLen += seg->len;
+    }
+    if (bufUsed > 0U) {
+        memmove(spi->batchBuf, &spi->batchBuf[bufUsed], (spi->batchBufLen - bufUsed));
+    }
+
+    spi->batchBufLen     = (uint16_t)(spi->batchBufLen - bufUsed);
+    spi->batchNbSegs     = (uint16_t)(spi->batchNbSegs - nbSegs);
+    spi->batchFrameStart = 0;
+
+    return status;
+}
+
+
+HAL_statusTypeDef spiBatchBegin(void)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+
+    if (!spi->isSPIInit || spi->batchOpen) {
+        printf(" error: spi batch cannot be opened\n");
+        return HAL_ERROR;
+    }
+
+    spi->batchNbSegs     = 0;
+    spi->batchFrameStart = 0;
+    spi->batchBufLen     = 0;
+    spi->batchMsgLen     = 0;
+    spi->batchOpen       = true;
+
+    return HAL_OK;
+}
+
+
+HAL_statusTypeDef spiBatchAdd(const uint8_t *txData, uint8_t *rxData, uint16_t length, bool csRelease)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+    uint16_t txLen = (txData ? length : 0U);
+
+    if (!spi->batchOpen) {
+        return HAL_ERROR;
+    }
+
+    if (length == 0U) {
+        return HAL_OK;
+    }
+
+    /* If the segment doesn't fit, flush the frames already completed */
+    if ((spi->batchNbSegs >= SPI_BATCH_MAX_XFERS) || ((spi->batchBufLen + txLen) > SPI_BATCH_BUF_LEN) || ((spi->batchMsgLen + length) > SPI_BATCH_MSG_MAX_LEN)) {
+        if (spiBatchSubmit(spi->batchFrameStart) != HAL_OK) {
+            return HAL_ERROR;
+        }
+
+        if ((spi->batchNbSegs >= SPI_BATCH_MAX_XFERS) || ((spi->batchBufLen + txLen) > SPI_BATCH_BUF_LEN) || ((spi->batchMsgLen + length) > SPI_BATCH_MSG_MAX_LEN)) {
+            printf("Error: SPI batch frame too long\n");
+            return HAL_ERROR;
+        }
+    }
+
+    spiBatchSeg *seg = &spi->batchSegs[spi->batchNbSegs++];
+    seg->txOff     = SPI_BATCH_NO_TX;
+    seg->rxData    = rxData;
+    seg->len       = length;
+    seg->csRelease = csRelease;
+
+    if (txData) {
+        memcpy(&spi->batchBuf[spi->batchBufLen], txData, length);
+        seg->txOff   = spi->batchBufLen;
+        spi->batchBufLen += length;
+    }
+    spi->batchMsgLen += length;
+
+    if (csRelease) {
+        spi->batchFrameStart = spi->batchNbSegs;
+    }
+
+    return HAL_OK;
+}
+
+
+HAL_statusTypeDef spiBatchFlush(void)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+
+    if (!spi->batchOpen) {
+        return HAL_ERROR;
+    }
+
+    /* A frame left open is terminated here */
+    if (spi->batchNbSegs > 0U) {
+        spi->batchSegs[spi->batchNbSegs - 1U].csRelease = true;
+    }
+    spi->batchFrameStart = spi->batchNbSegs;
+
+    return spiBatchSubmit(spi->batchNbSegs);
+}
+
+
+HAL_statusTypeDef spiBatchEnd(void)
+{
+    spiInstance *spi = &spiInst[pltf_instance_get()];
+    HAL_statusTypeDef status = spiBatchFlush();
+
+    spi->batchOpen = false;
+    return status;
+}
+
+
 void pltf_protect_com(void)
 {
-    pthread_mutex_lock(&lockCom);
+    pthread_mutex_lock(&spiInst[pltf_instance_get()].lockCom);
 }
 
 void pltf_unprotect_com(void)
 {
-    pthread_mutex_unlock(&lockCom);
+    pthread_mutex_unlock(&spiInst[pltf_instance_get()].lockCom);
 }
 
@@ -27,7 +27,9 @@
  *
  *   This module makes use of a System Tick in millisconds and provides
  *   an abstraction for SW timers.
- *   Modified to implement timers on Linux platform.
+ *   Modified to implement timers on Linux platform: timers are deadlines
+ *   on the monotonic clock kept on a pool of slots, a single timerfd armed
+ *   for the nearest deadline wakes up the event loop running the RFAL worker.
  *
  */
 
@@ -37,9 +39,11 @@
 ******************************************************************************
 */
 #include <time.h>
-#include <signal.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <pthread.h>
-#include <semaphore.h>
+#include <sys/timerfd.h>
 #include "pltf_timer.h"
 #include "platform.h"
 
@@ -49,23 +53,63 @@
 ******************************************************************************
 */
 
-/* Number of timers supported */
-#define PLT_TIMER_MAX 10U
+/* Initial number of timer slots, the pool grows when exhausted */
+#define PLT_TIMER_POOL_INIT   16U
+/* Max number of timer slots, limited by the handle index width */
+#define PLT_TIMER_POOL_MAX    0xFFFFU
+/* End of free slot list */
+#define PLT_TIMER_NONE        UINT32_MAX
 
+#define PLT_TIMER_IDX_MASK    0xFFFFU       /* Handle: slot index + 1   */
+#define PLT_TIMER_GEN_SHIFT   16U           /* Handle: slot generation  */
+
+#define PLT_NSEC_PER_USEC     1000ULL
+#define PLT_NSEC_PER_MSEC     1000000ULL
+#define PLT_NSEC_PER_SEC      1000000000ULL
+
+/* Last part of a us delay spent spinning instead of sleeping, absorbs the wake-up latency.
+ * 0 sleeps the whole delay */
+#ifndef PLT_DELAY_SPIN_US
+#define PLT_DELAY_SPIN_US     50U
+#endif
 
 /*
 ******************************************************************************
-* GLOBAL AND HELPER FUNCTIONS
+* LOCAL TYPES
 ******************************************************************************
 */
 
-/* Extern semaphore to signal once a timer expires */
-extern sem_t rfal_sem;
+/* Timer slot */
+typedef struct
+{
+    uint64_t deadline;    /* Expiration time on the monotonic clock (ns) */
+    uint32_t nextFree;    /* Next slot on the free list                  */
+    uint16_t gen;         /* Generation, invalidates stale handles       */
+    bool     active;      /* Slot in use                                 */
+} plfTimerSlot;
+
+/*
+******************************************************************************
+* LOCAL VARIABLES
+******************************************************************************
+*/
 
-/* Define an array of POSIX timers */
-timer_t platformTimers[PLT_TIMER_MAX];
+static pthread_once_t  timerOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t lockTimer = PTHREAD_MUTEX_INITIALIZER;
+static plfTimerSlot   *timerSlots;          /* Timer pool                                */
+static uint32_t        timerPoolLen;        /* Number of slots on the pool               */
+static uint32_t        timerFreeHead = PLT_TIMER_NONE; /* First free slot                */
+static uint64_t        timerArmed;          /* Deadline the timerfd is armed for, 0: off */
+static uint64_t        timerNow;            /* Last read of the monotonic clock (ns)     */
+static int             timerFd = -1;        /* timerfd waking up the event loop          */
 
 
+/*
+******************************************************************************
+* GLOBAL AND HELPER FUNCTIONS
+******************************************************************************
+*/
+
 /*****************************************************************************/
 static uint32_t ts2millisec(struct timespec* ts)
 {
@@ -73,6 +117,23 @@ static uint32_t ts2millisec(struct timespec* ts)
 }
 
 
+/*****************************************************************************/
+static uint64_t plfClockGetNs(void)
+{
+    struct timespec cur_ts;
+    clock_gettime(CLOCK_MONOTONIC, &cur_ts);
+    return (((uint64_t)cur_ts.tv_sec * PLT_NSEC_PER_SEC) + (uint64_t)cur_ts.tv_nsec);
+}
+
+
+/*****************************************************************************/
+static uint64_t plfTimerGetNow(void)
+{
+    timerNow = plfClockGetNs();
+    return timerNow;
+}
+
+
 /****************************************************************************/
 uint32_t platformGetSysTick_linux()
 {
@@ -83,112 +144,288 @@ uint32_t platformGetSysTick_linux()
 
 
 /****************************************************************************/
-static void timer_handler(union sigval sv)
+uint64_t platformGetSysTickUs_linux(void)
 {
-    /* Unlock Semaphore */
-    sem_post(&rfal_sem);
+    return (plfClockGetNs() / PLT_NSEC_PER_USEC);
 }
 
 
 /****************************************************************************/
-uint32_t plfTimerCreate(uint32_t time)
+uint64_t platformGetSysTickNs_linux(void)
 {
-    uint32_t timer = UINT32_MAX;
-    for (uint32_t i = 0; i < PLT_TIMER_MAX; i++)
+    return plfClockGetNs();
+}
+
+
+/****************************************************************************/
+void platformDelayUs_linux(uint32_t us)
+{
+    struct timespec ts;
+    uint64_t deadline;
+    uint64_t wakeup;
+
+    deadline = plfClockGetNs() + ((uint64_t)us * PLT_NSEC_PER_USEC);
+
+    /* Sleep on the absolute deadline so that interruptions do not stretch the delay */
+    if (us > PLT_DELAY_SPIN_US)
     {
-        /* Look for the first timer not used (handle is 0) */
-        if (platformTimers[i] == 0)
+        wakeup     = (deadline - ((uint64_t)PLT_DELAY_SPIN_US * PLT_NSEC_PER_USEC));
+        ts.tv_sec  = (time_t)(wakeup / PLT_NSEC_PER_SEC);
+        ts.tv_nsec = (long)(wakeup % PLT_NSEC_PER_SEC);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
         {
-            timer = i;
-            break;
+            /* Interrupted by a signal, sleep again till the same deadline */
         }
     }
-    if (timer >= PLT_TIMER_MAX)
-    {
-        platformLog("platformTimerCreate: timer %d creation failed\r\n", timer);
-        exit(EXIT_FAILURE);
-        return 0;
-    }
 
-    struct sigevent sevp = {
-        .sigev_notify          = SIGEV_THREAD,
-        .sigev_notify_function = timer_handler,
-    };
-    int rc = timer_create(CLOCK_MONOTONIC, &sevp, &platformTimers[timer]);
-    if (rc != 0)
+    /* Spin the remaining few us */
+    while (plfClockGetNs() < deadline)
     {
-        platformLog("platformTimerCreate: timer_create() failed (rc = %d)\r\n", rc);
-        exit(EXIT_FAILURE);
-        return 0;
     }
+}
 
-    /* Go beyond nearest tick */
-    time += 1;
+
+/****************************************************************************/
+static void plfTimerArm(uint64_t deadline)
+{
     struct itimerspec its = {
-       .it_interval.tv_sec  = 0,               /* Timer interval = 0, i.e. not a One-shot timer */
+       .it_interval.tv_sec  = 0,               /* One-shot */
        .it_interval.tv_nsec = 0,
 
-       .it_value.tv_sec     =  time / 1000U,   /* Initial expiration */
-       .it_value.tv_nsec    = (time % 1000U) * 1000000U,
+       .it_value.tv_sec     = (time_t)(deadline / PLT_NSEC_PER_SEC),
+       .it_value.tv_nsec    = (long)(deadline % PLT_NSEC_PER_SEC),
     };
 
-    rc = timer_settime(platformTimers[timer], CLOCK_REALTIME, &its, NULL);
-    if (rc != 0)
+    /* A zero it_value disarms the timerfd */
+    if (timerFd >= 0)
     {
-        platformLog("platformTimerCreate: timer_settime() timer %d failed (rc = %d) (param %d=>%d/%d)\r\n", timer, rc, time, its.it_value.tv_sec, its.it_value.tv_nsec);
-        exit(EXIT_FAILURE);
-        return 0;
+        timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &its, NULL);
     }
+    timerArmed = deadline;
+}
 
-    /* Start from index 1, don't use timer 0 as it has a specifing meaning in RFAL */
-    return timer + 1U;
+
+/****************************************************************************/
+static void plfTimerRearm(void)
+{
+    uint64_t next = 0;
+    uint32_t i;
+
+    /* Look for the nearest deadline still ahead */
+    for (i = 0; i < timerPoolLen; i++)
+    {
+        if (timerSlots[i].active && (timerSlots[i].deadline > timerNow))
+        {
+            if ((next == 0U) || (timerSlots[i].deadline < next))
+            {
+                next = timerSlots[i].deadline;
+            }
+        }
+    }
+
+    plfTimerArm(next);
 }
 
 
 /****************************************************************************/
-bool plfTimerIsExpired(uint32_t timer)
+static void plfTimerInit(void)
 {
-    /* Timer 0 as a specific meaning in RFAL, don't use it */
-    if (timer == 0U)
+    timerFd = timerfd_create(CLOCK_MONOTONIC, (TFD_NONBLOCK | TFD_CLOEXEC));
+    if (timerFd < 0)
     {
-        return true;
+        platformLog("platformTimerCreate: timerfd_create() failed\r\n");
     }
-    timer--;
-    if (timer >= PLT_TIMER_MAX)
+}
+
+
+/****************************************************************************/
+int plfTimerGetFd(void)
+{
+    pthread_once(&timerOnce, plfTimerInit);
+    return timerFd;
+}
+
+
+/****************************************************************************/
+void plfTimerProcess(void)
+{
+    uint64_t expirations;
+
+    /* Acknowledge the expiration and arm for the next deadline */
+    if (read(timerFd, &expirations, sizeof(expirations)) != sizeof(expirations))
     {
-        platformLog("platformTimerIsExpired: invalid timer %d\r\n", timer);
-        exit(EXIT_FAILURE);
-        return true;
+        return;
     }
 
-    struct itimerspec its;
-    timer_gettime(platformTimers[timer], &its);
-    return ( (its.it_value.tv_sec == 0) && (its.it_value.tv_nsec == 0) );
+    pthread_mutex_lock(&lockTimer);
+    plfTimerGetNow();
+    plfTimerRearm();
+    pthread_mutex_unlock(&lockTimer);
 }
 
 
 /****************************************************************************/
-void plfTimerDestroy(uint32_t timer)
+static bool plfTimerGrow(void)
+{
+    uint32_t      newLen = ((timerPoolLen == 0U) ? PLT_TIMER_POOL_INIT : (timerPoolLen * 2U));
+    plfTimerSlot *slots;
+    uint32_t      i;
+
+    if (newLen > PLT_TIMER_POOL_MAX)
+    {
+        newLen = PLT_TIMER_POOL_MAX;
+    }
+    if (newLen <= timerPoolLen)
+    {
+        return false;
+    }
+
+    slots = realloc(timerSlots, (newLen * sizeof(plfTimerSlot)));
+    if (slots == NULL)
+    {
+        return false;
+    }
+
+    /* Chain the new slots on the free list */
+    for (i = timerPoolLen; i < newLen; i++)
+    {
+        slots[i].deadline = 0;
+        slots[i].gen      = 0;
+        slots[i].active   = false;
+        slots[i].nextFree = (((i + 1U) < newLen) ? (i + 1U) : timerFreeHead);
+    }
+    timerFreeHead = timerPoolLen;
+    timerSlots    = slots;
+    timerPoolLen  = newLen;
+
+    return true;
+}
+
+
+/****************************************************************************/
+static plfTimerSlot *plfTimerGetSlot(uint32_t timer)
 {
+    uint32_t idx = (timer & PLT_TIMER_IDX_MASK);
+
     /* Timer 0 as a specific meaning in RFAL, don't use it */
-    if (timer == 0U)
+    if ((idx == 0U) || (idx > timerPoolLen))
     {
-        return;
+        return NULL;
     }
-    timer--;
-    if (timer >= PLT_TIMER_MAX)
+
+    /* Reject handles of a slot already released and reused */
+    if (!timerSlots[idx - 1U].active || (timerSlots[idx - 1U].gen != (uint16_t)(timer >> PLT_TIMER_GEN_SHIFT)))
     {
-        platformLog("platformTimerDestroy: invalid timer %d\r\n", timer);
-        exit(EXIT_FAILURE);
-        return;
+        return NULL;
+    }
+    return &timerSlots[idx - 1U];
+}
+
+
+/****************************************************************************/
+uint32_t plfTimerCreate(uint32_t time)
+{
+    plfTimerSlot *slot;
+    uint32_t      idx;
+    uint32_t      timer;
+
+    pthread_once(&timerOnce, plfTimerInit);
+
+    pthread_mutex_lock(&lockTimer);
+
+    if ((timerFreeHead == PLT_TIMER_NONE) && !plfTimerGrow())
+    {
+        pthread_mutex_unlock(&lockTimer);
+        platformLog("platformTimerCreate: no timer available\r\n");
+        return 0;
+    }
+
+    idx           = timerFreeHead;
+    slot          = &timerSlots[idx];
+    timerFreeHead = slot->nextFree;
+
+    slot->active   = true;
+    slot->gen++;
+    slot->deadline = (plfTimerGetNow() + ((uint64_t)time * PLT_NSEC_PER_MSEC));
+
+    /* Only the nearest deadline needs the timerfd */
+    if ((timerArmed == 0U) || (slot->deadline < timerArmed) || (timerArmed <= timerNow))
+    {
+        plfTimerArm(slot->deadline);
     }
 
-    if (timer_delete(platformTimers[timer]) != 0)
+    /* Start from index 1, don't use timer 0 as it has a specifing meaning in RFAL */
+    timer = (((uint32_t)slot->gen << PLT_TIMER_GEN_SHIFT) | (idx + 1U));
+
+    pthread_mutex_unlock(&lockTimer);
+
+    return timer;
+}
+
+
+/****************************************************************************/
+bool plfTimerIsExpired(uint32_t timer)
+{
+    plfTimerSlot *slot;
+    bool          expired;
+
+    pthread_mutex_lock(&lockTimer);
+
+    slot = plfTimerGetSlot(timer);
+    if (slot == NULL)
+    {
+        expired = true;
+    }
+    else
+    {
+        /* Read the clock only while the deadline is ahead of the cached time */
+        expired = (slot->deadline <= timerNow);
+        if (!expired)
+        {
+            expired = (slot->deadline <= plfTimerGetNow());
+        }
+    }
+
+    pthread_mutex_unlock(&lockTimer);
+
+    return expired;
+}
+
+
+/****************************************************************************/
+uint64_t plfTimerGetDeadline(uint32_t timer)
+{
+    plfTimerSlot *slot;
+    uint64_t      deadline;
+
+    pthread_mutex_lock(&lockTimer);
+
+    slot     = plfTimerGetSlot(timer);
+    deadline = ((slot == NULL) ? 0U : slot->deadline);
+
+    pthread_mutex_unlock(&lockTimer);
+
+    return deadline;
+}
+
+
+/****************************************************************************/
+void plfTimerDestroy(uint32_t timer)
+{
+    plfTimerSlot *slot;
+
+    pthread_mutex_lock(&lockTimer);
+
+    /* Destroying timer 0 or a timer already released is harmless */
+    slot = plfTimerGetSlot(timer);
+    if (slot != NULL)
     {
-        platformLog("timer_delete() %d failed\r\n", timer);
-        exit(EXIT_FAILURE);
+        /* Mark it back as an available timer, a pending timerfd wake-up is just spurious */
+        slot->active   = false;
+        slot->nextFree = timerFreeHead;
+        timerFreeHead  = (timer & PLT_TIMER_IDX_MASK) - 1U;
     }
 
-    /* Mark it back as an available timer */
-    platformTimers[timer] = 0;
+    pthread_mutex_unlock(&lockTimer);
 }
@@ -69,6 +69,9 @@
 
 #define RFAL_ANALOG_CONFIG_TBL_SIZE                 (1024U)   /*!< Maximum number of Register-Mask-Value in the Setting List    */
 
+#define RFAL_ANALOG_CONFIG_COMPILED_SETS            (32U)     /*!< Maximum number of compiled Configuration IDs                 */
+#define RFAL_ANALOG_CONFIG_COMPILED_REGS            (256U)    /*!< Maximum number of registers over all compiled Configurations */
+
 
 #define RFAL_ANALOG_CONFIG_POLL_LISTEN_MODE_MASK    (0x8000U) /*!< Mask bit of Poll Mode in Analog Configuration ID             */
 #define RFAL_ANALOG_CONFIG_TECH_MASK                (0x7F00U) /*!< Mask bits for Technology in Analog Configuration ID          */
@@ -327,6 +330,23 @@ ReturnCode rfalAnalogConfigListRead( rfalAnalogConfigOffset *configOffset, uint8
 ReturnCode rfalSetAnalogConfig( rfalAnalogConfigId configId );
 
 
+/*!
+ *****************************************************************************
+ * \brief  Get the generation of the Analog settings
+ *  
+ * The generation changes whenever the Analog Configuration Table is loaded
+ * or updated, whenever a Chip-Specific event other than Poll/Listen 
+ * common has applied register settings, and whenever settings failed to be
+ * applied. Settings applied for a mode remain in place as long as the 
+ * generation read before applying them does not change.
+ *
+ * \return  Current generation of the Analog settings
+ *
+ *****************************************************************************
+ */
+uint16_t rfalAnalogConfigGetGeneration( void );
+
+
 /*!
  *****************************************************************************
  * \brief  Generates Analog Config mode ID 
@@ -122,6 +122,25 @@ ReturnCode rfalChipReadReg( uint16_t reg, uint8_t* values, uint8_t len );
  */
 ReturnCode rfalChipChangeRegBits( uint16_t reg, uint8_t valueMask, uint8_t value );
 
+/*!
+ *****************************************************************************
+ * \brief Change consecutive registers on the RF Chip
+ *
+ * Change the value of the bits set in the valueMasks on several consecutive
+ * registers of the RF Chip, sending the new values in a single access.
+ * 
+ * \param[in] reg: address of the first register to be modified
+ * \param[in] valueMasks: mask value of the register bits to be changed, one per register
+ * \param[in] values: register values to be set, one per register
+ * \param[in] len: number of consecutive registers to be modified
+ * 
+ * \return ERR_PARAM    : Invalid register or bad request
+ * \return ERR_NOTSUPP  : Feature not supported
+ * \return ERR_NONE     : Change done with no error
+ *****************************************************************************
+ */
+ReturnCode rfalChipChangeRegBitsMultiple( uint16_t reg, const uint8_t* valueMasks, const uint8_t* values, uint8_t len );
+
 /*!
  *****************************************************************************
  * \brief Writes a Test register on the RF Chip
@@ -188,6 +207,35 @@ ReturnCode rfalChipChangeTestRegBits( uint16_t reg, uint8_t valueMask, uint8_t v
  */
 ReturnCode rfalChipExecCmd( uint16_t cmd );
 
+/*!
+ *****************************************************************************
+ * \brief Start a batch of RF Chip accesses
+ *
+ * The following register writes and commands are grouped and sent to the 
+ * RF Chip in a single bus transaction on rfalChipBatchEnd(). A read sends 
+ * the accesses queued so far.
+ * Batches cannot be nested.
+ * 
+ * \return ERR_WRONG_STATE : A batch is already ongoing
+ * \return ERR_NONE        : Batch started, or accesses are sent right away
+ *                           if the platform cannot group them
+ *****************************************************************************
+ */
+ReturnCode rfalChipBatchStart( void );
+
+/*!
+ *****************************************************************************
+ * \brief End a batch of RF Chip accesses
+ *
+ * Sends the accesses grouped since rfalChipBatchStart()
+ * 
+ * \return ERR_WRONG_STATE : No batch ongoing
+ * \return ERR_IO          : Error sending the batch
+ * \return ERR_NONE        : No error
+ *****************************************************************************
+ */
+ReturnCode rfalChipBatchEnd( void );
+
 /*! 
  *****************************************************************************
  * \brief  Set RFO
@@ -811,6 +811,25 @@ ReturnCode rfalIsoDepATTRIB( const uint8_t* nfcid0, uint8_t PARAM1, rfalBitRate
 ReturnCode rfalIsoDepDeselect( void );
 
 
+/*!
+ *****************************************************************************
+ *  \brief  ISO-DEP Presence Check
+ *
+ *  This function checks whether the activated PICC is still in the field
+ *  by sending an R(NAK) and waiting for its R(ACK) in a blocking way.
+ *  The PICC and the ISO-DEP layer keep their state, the data exchange
+ *  may go on afterwards.
+ *  It shall only be called between data exchanges.
+ *
+ *  \return ERR_NONE   : PICC present
+ *  \return ERR_TIMEOUT: No response rcvd from PICC 
+ *  \return ERR_PROTO  : Unexpected response rcvd from PICC 
+ *
+ *****************************************************************************
+ */
+ReturnCode rfalIsoDepPresenceCheck( void );
+
+
 /*! 
  *****************************************************************************
  *  \brief  ISO-DEP Poller Handle NFC-A Activation
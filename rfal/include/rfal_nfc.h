@@ -195,7 +195,10 @@ typedef struct{
     rfalComplianceMode compMode;                        /*!< Compliancy mode to be used                            */
     uint16_t           techs2Find;                      /*!< Technologies to search for                            */
     uint16_t           totalDuration;                   /*!< Duration of a whole Poll + Listen cycle               */
+    uint8_t            techDemoteCycles;                /*!< Polls without hit to demote a technology, 0: disabled */
+    bool               fastReselect;                    /*!< Reselect the devices activated before by their UID    */
     uint8_t            devLimit;                        /*!< Max number of devices                                 */
+    rfalNfcDevice      *devTable;                       /*!< Device table of devLimit entries, NULL: internal one  */
     rfalBitRate        maxBR;                           /*!< Max Bit rate to be used for communications            */
     
     rfalBitRate        nfcfBR;                          /*!< Bit rate to poll for NFC-F                            */
@@ -209,6 +212,7 @@ typedef struct{
     rfalLmConfPF       lmConfigPF;                      /*!< Configuration for Passive Listen mode NFC-A           */
     
     void               (*notifyCb)( rfalNfcState st );  /*!< Callback to Notify upper layer                        */
+    bool               (*devFoundCb)( const rfalNfcDevice *dev ); /*!< Callback on each device resolved, NULL if not used */
                                                         
     bool               wakeupEnabled;                   /*!< Enable Wake-Up mode before polling                    */
     bool               wakeupConfigDefault;             /*!< Wake-Up mode default configuration                    */
@@ -253,6 +257,36 @@ void rfalNfcWorker( void );
  */
 ReturnCode rfalNfcInitialize( void );
 
+/*!
+ *****************************************************************************
+ * \brief  RFAL NFC Default Discovery Parameters
+ *  
+ * It sets the given discovery parameters to their defaults: NFC compliance
+ * mode, a single device on the internal table, no technology to search for,
+ * RFAL_BR_KEEP as max bit rate, NFC-F polled at 212 and AP2P at 424, 
+ * Wake-up mode disabled with its default configuration, and all the 
+ * optional features (devTable, devFoundCb, techDemoteCycles, fastReselect
+ * and notifyCb) disabled.
+ *
+ * It shall be called on the parameters before they are set, so that the 
+ * fields not explicitly set by the caller hold a defined value. 
+ * Ex:
+ * \code
+ *   rfalNfcDiscoverParam discParam;
+ *
+ *   rfalNfcDefaultDiscParams( &discParam );
+ *   discParam.techs2Find    = ( RFAL_NFC_POLL_TECH_A | RFAL_NFC_POLL_TECH_V );
+ *   discParam.totalDuration = 1000U;
+ *   discParam.notifyCb      = appNotif;
+ *
+ *   rfalNfcDiscover( &discParam );
+ * \endcode
+ *
+ * \param[out]  disParams   : discovery parameters to be set to the defaults
+ *****************************************************************************
+ */
+void rfalNfcDefaultDiscParams( rfalNfcDiscoverParam *disParams );
+
 /*!
  *****************************************************************************
  * \brief  RFAL NFC Discovery
@@ -261,9 +295,42 @@ ReturnCode rfalNfcInitialize( void );
  * In discovery it will Poll and/or Listen for the technologies configured, 
  * and perform Wake-up mode if configured to do so.
  *
+ * The disParams shall be initialized with rfalNfcDefaultDiscParams() before
+ * being set: the optional fields (devTable, devFoundCb, techDemoteCycles,
+ * fastReselect) are only disabled by their NULL/0/false value.
  * The device list passed on disParams must not be empty.
  * The number of devices on the list is indicated by the devLimit and shall
  * be at >= 1.
+ * The devices found are placed on the device table given by devTable, 
+ * which shall hold devLimit devices and stay valid till the discovery is
+ * deactivated. If devTable is NULL an internal table is used and devLimit
+ * shall not exceed RFAL_NFC_MAX_DEVICES.
+ * A device found again during the Collision Resolution, by its type and
+ * UID, is only kept once.
+ * If techDemoteCycles is set the Technology Detection adapts to the devices
+ * found: the technologies found most often on the last 32 polling cycles 
+ * are polled first, and a technology not found on its last techDemoteCycles
+ * polls is only polled once every RFAL_NFC_DEMOTED_POLL_PERIOD cycles till
+ * it is found again. Otherwise all technologies are polled on every cycle,
+ * in a fixed order.
+ * If fastReselect is set the NFC-A, NFC-B and NFC-V devices activated are
+ * kept on a cache of the last RFAL_NFC_RESELECT_CACHE_LEN ones, by UID/PUPI.
+ * When one of them is back in the field it is reselected directly, 
+ * skipping the anticollision: SEL_REQ by NFCID1 on NFC-A, while on NFC-B
+ * and NFC-V the SENSB_RES/INVENTORY_RES received on the Technology 
+ * Detection is taken as is when it holds a known PUPI/UID, with no further
+ * exchange. At most one cached device is tried per technology, the one 
+ * matching the SENS_RES, PUPI or UID already received. When the device 
+ * found is not a cached one the full Collision Resolution is performed, and
+ * a cached device that fails activation is removed. It only applies with 
+ * NFC compliance mode and a devLimit of 1.
+ * If devFoundCb is set it is called on each NFC-A, NFC-B, NFC-F and NFC-V
+ * device as soon as the technology Collision Resolution resolves it, while
+ * the resolution goes on. Only the type and dev fields of the device given
+ * are set, and only during the call. Returning false rejects the device,
+ * which is then not placed on the device table. A device already on the
+ * table is not reported again. The callback shall not perform any RF 
+ * communication, RF work on a device starts once it is activated.
  *
  * \param[in]  disParams    : discovery configuration parameters
  *
@@ -364,6 +431,34 @@ ReturnCode rfalNfcSelect( uint8_t devIdx );
  */
 ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt );
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Start Data Exchange with completion callback
+ *  
+ * Same as rfalNfcDataExchangeStart() and additionally, once the Data Exchange
+ * has terminated, rfalNfcWorker calls the given callback with the user 
+ * pointer and the status rfalNfcDataExchangeGetStatus() would return.
+ * The callback may start the next Data Exchange.
+ *
+ * In Listen mode the first frame is already available when this method 
+ * returns, the callback is not called for it.
+ *
+ * \param[in]  txData       : data to be transmitted
+ * \param[in]  txDataLen    : size of the data to be transmitted
+ * \param[out] rxData       : location of the received data after operation is completed
+ * \param[out] rvdLen       : location of thelength of the received data
+ * \param[in]  fwt          : FWT to be used in case of RF interface.
+ *                            If ISO-DEP or NFC-DEP interface is used, this will be ignored
+ * \param[in]  cb           : completion callback, NULL if not used
+ * \param[in]  userParam    : user pointer passed to the callback
+ *
+ * \return ERR_WRONG_STATE  : Incorrect state for this operation
+ * \return ERR_PARAM        : Invalid parameters
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode rfalNfcDataExchangeStartCb( uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt, rfalTransceiveCallback cb, void *userParam );
+
 /*! 
  *****************************************************************************
  * \brief  RFAL NFC Get Data Exchange Status
@@ -387,6 +482,36 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
  */
 ReturnCode rfalNfcDataExchangeGetStatus( void );
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL NFC Presence Check
+ *  
+ * Checks whether the active device is still in the field using the 
+ * cheapest exchange valid for its technology and interface:
+ *   ISO-DEP : R(NAK), answered with R(ACK)
+ *   NFC-DEP : ATN, answered with ATN
+ *   T1T     : RID           T2T    : READ block 0
+ *   NFC-B   : SENSB_REQ     NFC-F  : SENSF_REQ with a single slot
+ *   NFC-V   : INVENTORY masked with the device UID
+ *   ST25TB  : GET_UID
+ * 
+ * The answer must come from the active device. The check leaves the
+ * protocol and the RFAL NFC state intact, the Data Exchange may resume
+ * afterwards. It is a blocking method.
+ *
+ * \param[out]  latencyUs    : time taken by the check in us, may be NULL
+ *
+ * \return ERR_WRONG_STATE  : Not activated or Data Exchange ongoing
+ * \return ERR_REQUEST      : No active device
+ * \return ERR_NOTSUPP      : No presence check for the active device
+ * \return ERR_NOTFOUND     : Answer from a different device
+ * \return ERR_TIMEOUT      : No response, device removed
+ * \return ERR_PROTO        : Unexpected response
+ * \return ERR_NONE         : Active device present
+ *****************************************************************************
+ */
+ReturnCode rfalNfcPresenceCheck( uint32_t *latencyUs );
+
 /*! 
  *****************************************************************************
  * \brief  RFAL NFC Deactivate
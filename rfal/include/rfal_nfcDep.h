@@ -576,6 +576,24 @@ ReturnCode rfalNfcDepDSL( void );
 ReturnCode rfalNfcDepRLS( void );
 
 
+/*!
+ ******************************************************************************
+ * \brief NFC-DEP Initiator Presence Check
+ * 
+ * This method sends an Attention (ATN) to the Target and waits its ATN
+ * response in a blocking way. The PNI and the DEP state are kept, the
+ * data exchange may go on afterwards.
+ * It shall only be called by the Initiator between data exchanges.
+ * 
+ * \return ERR_NONE        : Target present
+ * \return ERR_WRONG_STATE : Configured as Target
+ * \return ERR_TIMEOUT     : Timeout occurred
+ * \return ERR_PROTO       : Protocol error occurred
+ ******************************************************************************
+ */
+ReturnCode rfalNfcDepPresenceCheck( void );
+
+
 /*! 
  *****************************************************************************
  *  \brief  NFC-DEP Initiator Handle  Activation
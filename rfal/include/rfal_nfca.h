@@ -190,6 +190,9 @@ typedef struct
     bool                     isSleep;                             /*!< Device sleeping flag                                                       */
 } rfalNfcaListenDevice;
 
+/*! Callback executed on each NFC-A device resolved, returns false to reject the device */
+typedef bool (* rfalNfcaDevFoundCallback)( const rfalNfcaListenDevice *dev );
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -439,6 +442,24 @@ ReturnCode rfalNfcaPollerStartFullCollisionResolution( rfalComplianceMode compMo
 ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void );
 
 
+/*!
+ *****************************************************************************
+ *  \brief  NFC-A Set Device Found Callback
+ *
+ *  Sets the callback executed by the Full Collision Resolution as soon as
+ *  each device is resolved (after its SEL_RES), before the resolution
+ *  goes on with the remaining devices.
+ *  If the callback returns false the device is put to sleep and it is
+ *  not placed on the device list nor counted on devCnt.
+ *  The callback runs within the collision resolution and shall not 
+ *  perform any RF communication.
+ *
+ *  \param[in]  pFunc : callback to be used, NULL to disable it
+ *****************************************************************************
+ */
+void rfalNfcaPollerSetDevFoundCallback( rfalNfcaDevFoundCallback pFunc );
+
+
 /*!
  *****************************************************************************
  * \brief NFC-A Listener is SLP_REQ 
@@ -177,6 +177,9 @@ typedef struct
     bool              isSleep;                                  /*!< Device sleeping flag  */
 }rfalNfcbListenDevice;
 
+/*! Callback executed on each NFC-B device found, returns false to reject the device */
+typedef bool (* rfalNfcbDevFoundCallback)( const rfalNfcbListenDevice *dev );
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -372,6 +375,23 @@ ReturnCode rfalNfcbPollerCollisionResolution( rfalComplianceMode compMode, uint8
 ReturnCode rfalNfcbPollerSlottedCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-B Set Device Found Callback
+ *
+ * Sets the callback executed by the Collision Resolution as soon as each 
+ * valid SENSB_RES is received, before the remaining slots are processed.
+ * If the callback returns false the device is put to sleep (SLPB_REQ) and 
+ * it is not placed on the device list nor counted on devCnt.
+ * The callback runs within the collision resolution and shall not perform
+ * any RF communication.
+ *
+ * \param[in]  pFunc : callback to be used, NULL to disable it
+ *****************************************************************************
+ */
+void rfalNfcbPollerSetDevFoundCallback( rfalNfcbDevFoundCallback pFunc );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-B TR2 code to FDT
@@ -175,6 +175,9 @@ typedef struct
     rfalNfcfSensfRes  sensfRes;                 /*!< SENF_RES           */
 } rfalNfcfListenDevice;
 
+/*! Callback executed on each NFC-F device found, returns false to reject the device */
+typedef bool (* rfalNfcfDevFoundCallback)( const rfalNfcfListenDevice *dev );
+
 typedef  uint16_t rfalNfcfServ;                 /*!< NFC-F Service Code */
 
 /*! NFC-F Block List Element (2 or 3 bytes element)       T3T 1.0 5.6.1 */
@@ -288,6 +291,24 @@ ReturnCode rfalNfcfPollerPoll( rfalFeliCaPollSlots slots, uint16_t sysCode, uint
 ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8_t devLimit, rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  NFC-F Set Device Found Callback
+ *
+ * Sets the callback executed by the Collision Resolution on each device
+ * found. All NFC-F devices answer within the same Polling time slots, so 
+ * the devices are reported once the SENSF_RES collected are final.
+ * If the callback returns false the device is not placed on the device 
+ * list nor counted on devCnt.
+ * The callback runs within the collision resolution and shall not perform
+ * any RF communication.
+ *
+ * \param[in]  pFunc : callback to be used, NULL to disable it
+ *****************************************************************************
+ */
+void rfalNfcfPollerSetDevFoundCallback( rfalNfcfDevFoundCallback pFunc );
+
+
 /*! 
  *****************************************************************************
  * \brief  NFC-F Poller Check/Read
@@ -245,6 +245,9 @@ typedef struct
     bool                    isSleep;    /*!< Device sleeping flag           */
 } rfalNfcvListenDevice;
 
+/*! Callback executed on each NFC-V device found, returns false to reject the device */
+typedef bool (* rfalNfcvDevFoundCallback)( const rfalNfcvListenDevice *dev );
+
 
 /*
 ******************************************************************************
@@ -356,6 +359,23 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
  */
 ReturnCode rfalNfcvPollerSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt );
 
+/*!
+ *****************************************************************************
+ * \brief  NFC-V Set Device Found Callback
+ *
+ * Sets the callback executed by the Collision Resolution as soon as each 
+ * valid INVENTORY_RES is received, before the remaining slots are processed.
+ * If the callback returns false the device is not placed on the device list
+ * nor counted on devCnt. It is not silenced, a following inventory may 
+ * report it again.
+ * The callback runs within the collision resolution and shall not perform
+ * any RF communication.
+ *
+ * \param[in]  pFunc : callback to be used, NULL to disable it
+ *****************************************************************************
+ */
+void rfalNfcvPollerSetDevFoundCallback( rfalNfcvDevFoundCallback pFunc );
+
 /*! 
  *****************************************************************************
  * \brief  NFC-V Poller Sleep
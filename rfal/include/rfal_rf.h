@@ -129,6 +129,8 @@
 #define RFAL_NFCID1_DOUBLE_LEN                     7U                                           /*!< NFCID1 length                                     */
 #define RFAL_NFCID1_SINGLE_LEN                     4U                                           /*!< NFCID1 length                                     */
 
+#define RFAL_PROF_HIST_LEN                         16U                                          /*!< Number of log2 us buckets of a latency histogram  */
+
 
 /*
 ******************************************************************************
@@ -221,7 +223,9 @@
     (ctx).rxBufLen  = (uint16_t)rfalConvBytesToBits(rBL);                   \
     (ctx).rxRcvdLen = (uint16_t*)(rdL);                                     \
     (ctx).flags     = (uint32_t)(fl);                                       \
-    (ctx).fwt       = (uint32_t)(t);
+    (ctx).fwt       = (uint32_t)(t);                                        \
+    (ctx).callback  = NULL;                                                 \
+    (ctx).userParam = NULL;
 
 
 #define rfalLogE(...)             platformLog(__VA_ARGS__)        /*!< Macro for the error log method                  */
@@ -386,6 +390,68 @@ typedef enum {
 } rfalEHandling;
 
 
+/*! RFAL FIFO water level strategy                                                                                                           */
+typedef enum {
+    RFAL_FIFO_WL_FIXED               = 0,         /*!< Each water level interrupt moves a water level sized chunk                            */
+    RFAL_FIFO_WL_ADAPTIVE            = 1          /*!< On fast and long frames each water level interrupt fills|drains the live FIFO level   */
+} rfalFifoWLStrategy;
+
+
+/*! RFAL FIFO water level configuration, see rfalSetFifoWLConfig()                                                                           */
+typedef struct {
+    rfalFifoWLStrategy strategy;                  /*!< Strategy used on the frames matching minBR and minLen                                 */
+    rfalBitRate        minBR;                     /*!< Lowest bit rate on which the strategy is used                                         */
+    uint16_t           minLen;                    /*!< Shortest frame (Tx) or rxBuf (Rx) in bytes on which the strategy is used              */
+} rfalFifoWLConfig;
+
+
+/*! RFAL FIFO margins observed on the water level interrupts since the last clear                                                           */
+typedef struct {
+    uint16_t           txMinLevel;                /*!< Lowest FIFO level found when reloading on Tx: underrun margin in bytes               */
+    uint16_t           rxMinFree;                 /*!< Lowest FIFO free space found when draining on Rx: overrun margin in bytes            */
+    uint16_t           underruns;                 /*!< Number of FIFO underruns flagged on Tx                                                */
+    uint16_t           overruns;                  /*!< Number of FIFO overruns flagged on Rx                                                 */
+    uint16_t           bursts;                    /*!< Number of FIFO bursts on water level interrupts                                       */
+} rfalFifoMargins;
+
+
+/*! RFAL transceive phases timed by the latency profiler                                                                                    */
+typedef enum {
+    RFAL_PROF_PHASE_WAIT_GT          = 0,         /*!< Start of the transceive till GT has elapsed (TX_IDLE, TX_WAIT_GT)                     */
+    RFAL_PROF_PHASE_WAIT_FDT         = 1,         /*!< Waiting FDT Poll (TX_WAIT_FDT)                                                        */
+    RFAL_PROF_PHASE_TRANSMIT         = 2,         /*!< FIFO load, transmit command and transmission till TXE (TX_TRANSMIT .. TX_DONE)        */
+    RFAL_PROF_PHASE_WAIT_RXS         = 3,         /*!< Waiting the response start (RX_IDLE, RX_WAIT_EON, RX_WAIT_RXS)                        */
+    RFAL_PROF_PHASE_WAIT_RXE         = 4,         /*!< Reception, between FIFO reads (RX_WAIT_RXE, RX_WAIT_EOF)                              */
+    RFAL_PROF_PHASE_READ_FIFO        = 5,         /*!< FIFO reads and frame checks (RX_READ_FIFO, RX_ERR_CHECK, RX_READ_DATA .. done)        */
+    RFAL_PROF_PHASE_TOTAL            = 6,         /*!< Whole transceive, from rfalStartTransceive() till done                                */
+    RFAL_PROF_PHASE_NUM              = 7          /*!< Number of profiled phases                                                             */
+} rfalProfPhase;
+
+
+/*! RFAL latency of a transceive phase                                                                                                      */
+typedef struct {
+    uint32_t           count;                     /*!< Number of transceives which went through this phase                                   */
+    uint64_t           sumNs;                     /*!< Sum of the time spent on this phase in ns                                             */
+    uint64_t           minNs;                     /*!< Shortest time spent on this phase in ns                                               */
+    uint64_t           maxNs;                     /*!< Longest time spent on this phase in ns                                                */
+    uint32_t           hist[RFAL_PROF_HIST_LEN];  /*!< Histogram, bucket n: [2^n ; 2^(n+1)[ us, first and last buckets also below|above    */
+} rfalProfPhaseStats;
+
+
+/*! RFAL transceive latencies of a mode and bit rates, see rfalGetProfStats()                                                               */
+typedef struct {
+    rfalMode           mode;                      /*!< Mode (technology) of the transceives                                                  */
+    rfalBitRate        txBR;                      /*!< Tx bit rate of the transceives                                                        */
+    rfalBitRate        rxBR;                      /*!< Rx bit rate of the transceives                                                        */
+    uint32_t           errors;                    /*!< Number of transceives which completed with an error                                   */
+    rfalProfPhaseStats phase[RFAL_PROF_PHASE_NUM];/*!< Latency of each phase                                                                 */
+} rfalProfStats;
+
+
+/*! Callback to be executed once a Transceive has completed, with the user pointer and the Transceive status */
+typedef void (* rfalTransceiveCallback)( void *userParam, ReturnCode status );
+
+
 /*! Struct that holds all context to be used on a Transceive                                                */
 typedef struct {
     uint8_t*              txBuf;                  /*!< (In)  Buffer where outgoing message is located       */
@@ -397,6 +463,9 @@ typedef struct {
     
     uint32_t              flags;                  /*!< (In)  TransceiveFlags indication special handling    */
     uint32_t              fwt;                    /*!< (In)  Frame Waiting Time in 1/fc                     */
+    
+    rfalTransceiveCallback callback;              /*!< (In)  Completion callback, NULL if not used          */
+    void*                 userParam;              /*!< (In)  User pointer passed to the callback            */
 } rfalTransceiveContext;
 
 
@@ -726,6 +795,13 @@ ReturnCode rfalDeinitialize( void );
  * \warning the mode will be applied immediately on the RFchip regardless of 
  *          any ongoing operations like Transceive, ListenMode
  * 
+ * The mode settings are only applied if they differ from the ones in place
+ * on the RFchip, or if the Analog Configuration generation has changed.
+ * Active communication modes are always fully applied, as they also set up
+ * the RFchip timers. Likewise the bit rate settings are only applied if 
+ * they differ.
+ * Use rfalInvalidateMode() to force a full reconfiguration.
+ * 
  * \param[in]  mode : mode for the RFAL/RFchip to perform
  * \param[in]  txBR : transmit bit rate
  * \param[in]  rxBR : receive bit rate 
@@ -742,6 +818,25 @@ ReturnCode rfalDeinitialize( void );
 ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR );
 
 
+/*! 
+ *****************************************************************************
+ * \brief  RFAL Invalidate Mode
+ *  
+ * Discards the mode and bit rates known to be in place on the RFchip, so 
+ * that the next rfalSetMode() and rfalSetBitRate() fully reconfigure it.
+ * 
+ * RFAL takes care of its own operations that reprogram the RFchip
+ * (initialize, Listen Mode, Wake-Up Mode, Low Power Mode). This method  
+ * is to be used after errors or resets not seen by RFAL, or after 
+ * changing mode related registers directly with rfalChip*() methods
+ * 
+ * \see rfalSetMode
+ *
+ *****************************************************************************
+ */
+void rfalInvalidateMode( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  RFAL Get Mode
@@ -872,6 +967,88 @@ void rfalGetObsvMode( uint8_t* txMode, uint8_t* rxMode );
 void rfalDisableObsvMode( void );
 
 
+/*! 
+ *****************************************************************************
+ * \brief Set FIFO water level configuration
+ *  
+ * Sets how the FIFO is reloaded on Tx and drained on Rx for frames that do
+ * not fit in the FIFO. The fixed strategy moves a water level sized chunk on
+ * each water level interrupt. The adaptive strategy reads the live FIFO level
+ * and fills|drains it in a single burst, so fast frames take fewer interrupts
+ * and leave more margin against FIFO underrun and overrun.
+ * The strategy applies to the transceives whose bit rate is at least minBR
+ * and whose length is at least minLen, others use the fixed strategy.
+ *
+ * \param[in]  config : FIFO water level configuration
+ * 
+ * \return ERR_PARAM : Invalid configuration
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+ReturnCode rfalSetFifoWLConfig( const rfalFifoWLConfig *config );
+
+
+/*! 
+ *****************************************************************************
+ * \brief Get FIFO water level configuration
+ *  
+ * \param[out] config : current FIFO water level configuration
+ * 
+ *****************************************************************************
+ */
+void rfalGetFifoWLConfig( rfalFifoWLConfig *config );
+
+
+/*! 
+ *****************************************************************************
+ * \brief Get FIFO margins
+ *  
+ * Gets the FIFO margins observed on the water level interrupts of the 
+ * transceives since the RFAL initialization or the last clear.
+ * With the fixed strategy the level is the one read by the ISR along with 
+ * the water level interrupt. A margin not yet measured is reported as the 
+ * FIFO depth.
+ *
+ * \param[out] margins : FIFO margins
+ * \param[in]  clear   : restart the measurement after reading
+ * 
+ *****************************************************************************
+ */
+void rfalGetFifoMargins( rfalFifoMargins *margins, bool clear );
+
+
+/*! 
+ *****************************************************************************
+ * \brief Get transceive latencies
+ *  
+ * Gets the latencies measured by the transceive profiler, one entry per 
+ * mode and bit rates used since the RFAL initialization or the last clear.
+ * Each transceive phase is timed from the first state of the phase till 
+ * the first state of another phase on a monotonic ns clock, a phase 
+ * entered several times (e.g. Rx WL interrupts) accumulates its times.
+ * Only available with RFAL_FEATURE_PROFILER.
+ *
+ * \param[out] stats    : buffer to place the latencies
+ * \param[in]  statsLen : number of entries that fit on stats
+ * 
+ * \return number of entries placed on stats
+ *****************************************************************************
+ */
+uint8_t rfalGetProfStats( rfalProfStats *stats, uint8_t statsLen );
+
+
+/*! 
+ *****************************************************************************
+ * \brief Clear transceive latencies
+ *  
+ * Drops all latencies measured by the transceive profiler.
+ * Only available with RFAL_FEATURE_PROFILER.
+ * 
+ *****************************************************************************
+ */
+void rfalClearProfStats( void );
+
+
 /*! 
  *****************************************************************************
  * \brief  RFAL Set FDT Poll
@@ -997,6 +1174,8 @@ bool rfalIsGTExpired( void );
  * 
  * After Field On, if GT was set before, it starts the GT timer to be 
  * used on the following communications.
+ * With RFAL_FEATURE_HW_TIMERS a GT up to the GPT range is timed by the
+ * ST25R3916 GPT instead of a ms SW timer, unless the GPT is still busy.
  *  
  * \return ERR_RF_COLLISION : External field detected
  * \return ERR_NONE         : Field turned On
@@ -1034,6 +1213,12 @@ ReturnCode rfalFieldOff( void );
  * This method only sets the context, once set rfalWorker has
  * to be executed until is done
  * 
+ * If a completion callback is given on the context, rfalWorker calls it
+ * once the Transceive has reached RFAL_TXRX_STATE_IDLE, with the same 
+ * status rfalGetTransceiveStatus() would return. It is called outside the
+ * worker protection so it may start the next Transceive. It is not called
+ * if the Transceive is aborted (e.g. rfalFieldOff())
+ * 
  * \param[in]  ctx : the context for the following Transceive
  * 
  * \see  rfalWorker
@@ -63,12 +63,18 @@
 
 #define RFAL_TEST_REG         0x0080U      /*!< Test Register indicator  */    
 
+#define RFAL_ANALOG_CONFIG_INDEX_BUCKETS      (32U)   /*!< Index buckets: Poll/Listen mode x Bit rate               */
+
+
 /*
  ******************************************************************************
  * MACROS
  ******************************************************************************
  */
 
+/*! Index bucket of a Configuration ID: the mode and bit rate must always match exactly on a search */
+#define RFAL_ANALOG_CONFIG_INDEX_KEY(id)      ((uint8_t)((((id) & RFAL_ANALOG_CONFIG_POLL_LISTEN_MODE_MASK) >> (RFAL_ANALOG_CONFIG_POLL_LISTEN_MODE_SHIFT - 4U)) | (((id) & RFAL_ANALOG_CONFIG_BITRATE_MASK) >> RFAL_ANALOG_CONFIG_BITRATE_SHIFT)))
+
 /*
  ******************************************************************************
  * LOCAL DATA TYPES
@@ -76,18 +82,48 @@
  */
 
 #if RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG
-    static uint8_t gRfalAnalogConfig[RFAL_ANALOG_CONFIG_TBL_SIZE]; /*!< Analog Configuration Settings List */
+    static uint8_t gRfalAnalogConfigInst[ST25R_MAX_INSTANCES][RFAL_ANALOG_CONFIG_TBL_SIZE]; /*!< Analog Configuration Settings List, one per ST25R */
+    #define gRfalAnalogConfig    (gRfalAnalogConfigInst[platformGetInstance()])          /*!< Analog Configuration Settings List of the caller */
 #endif /* RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG */
 
 
+/*! Register changes of a Configuration ID compiled from the Look Up Table */
+typedef struct {
+    rfalAnalogConfigId configId;     /*!< Configuration ID                                        */
+    uint16_t           first;        /*!< Index of the first register change                      */
+    uint16_t           num;          /*!< Number of register changes                              */
+} rfalAnalogConfigCompiledSet;
+
+/*! Compiled Configuration IDs, register changes in Table order */
+typedef struct {
+    rfalAnalogConfigCompiledSet sets[RFAL_ANALOG_CONFIG_COMPILED_SETS];  /*!< Compiled Configuration IDs   */
+    uint8_t  setsNum;                                   /*!< Number of compiled Configuration IDs          */
+    uint16_t regsNum;                                   /*!< Number of register changes used               */
+    uint16_t addr[RFAL_ANALOG_CONFIG_COMPILED_REGS];    /*!< Register addresses                            */
+    uint8_t  mask[RFAL_ANALOG_CONFIG_COMPILED_REGS];    /*!< Register masks                                */
+    uint8_t  val[RFAL_ANALOG_CONFIG_COMPILED_REGS];     /*!< Register values                               */
+} rfalAnalogConfigCompiled;
+
+/*! Index of the Look Up Table entries per mode and bit rate, in Table order */
+typedef struct {
+    bool     valid;                                          /*!< Index matches the current Table          */
+    uint8_t  first[RFAL_ANALOG_CONFIG_INDEX_BUCKETS + 1U];   /*!< First entry of each bucket               */
+    uint16_t id[RFAL_ANALOG_CONFIG_LUT_SIZE];                /*!< Configuration ID of the entries          */
+    uint16_t offset[RFAL_ANALOG_CONFIG_LUT_SIZE];            /*!< Offset of the entries on the Table       */
+} rfalAnalogConfigIndex;
+
 /*! Struct for Analog Config Look Up Table Update */
 typedef struct {
     const uint8_t *currentAnalogConfigTbl; /*!< Reference to start of current Analog Configuration      */
     uint16_t configTblSize;          /*!< Total size of Analog Configuration                      */
     bool    ready;                  /*!< Indicate if Look Up Table is complete and ready for use */
+    rfalAnalogConfigCompiled compiled; /*!< Configuration IDs compiled from the current Table   */
+    rfalAnalogConfigIndex    index;    /*!< Index of the current Table                         */
+    uint16_t                 generation; /*!< Changed on Table update or chip event settings    */
 } rfalAnalogConfigMgmt;
 
-static rfalAnalogConfigMgmt   gRfalAnalogConfigMgmt;  /*!< Analog Configuration LUT management */
+static rfalAnalogConfigMgmt   gRfalAnalogConfigMgmtInst[ST25R_MAX_INSTANCES];  /*!< Analog Configuration LUT management, one per ST25R */
+#define gRfalAnalogConfigMgmt    (gRfalAnalogConfigMgmtInst[platformGetInstance()]) /*!< Analog Configuration LUT management of the caller */
 
 /*
  ******************************************************************************
@@ -101,6 +137,10 @@ static rfalAnalogConfigMgmt   gRfalAnalogConfigMgmt;  /*!< Analog Configuration
  ******************************************************************************
  */
 static rfalAnalogConfigNum rfalAnalogConfigSearch( rfalAnalogConfigId configId, uint16_t *configOffset );
+static void rfalAnalogConfigIndexBuild( void );
+static ReturnCode rfalAnalogConfigApply( rfalAnalogConfigId configId );
+static const rfalAnalogConfigCompiledSet* rfalAnalogConfigCompile( rfalAnalogConfigId configId );
+static ReturnCode rfalAnalogConfigApplyCompiled( const rfalAnalogConfigCompiledSet *set );
 
 #if RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG
     static void rfalAnalogConfigPtrUpdate( const uint8_t* analogConfigTbl );
@@ -131,6 +171,10 @@ void rfalAnalogConfigInitialize( void )
     gRfalAnalogConfigMgmt.configTblSize          = sizeof(rfalAnalogConfigDefaultSettings);
 #endif
   
+  gRfalAnalogConfigMgmt.compiled.setsNum = 0;
+  gRfalAnalogConfigMgmt.compiled.regsNum = 0;
+  rfalAnalogConfigIndexBuild();
+  gRfalAnalogConfigMgmt.generation++;
   gRfalAnalogConfigMgmt.ready = true;
 } /* rfalAnalogConfigInitialize() */
 
@@ -294,54 +338,53 @@ ReturnCode rfalAnalogConfigListRead( rfalAnalogConfigOffset *configOffset, uint8
 
 ReturnCode rfalSetAnalogConfig( rfalAnalogConfigId configId )
 {
-    rfalAnalogConfigOffset configOffset = 0;
-    rfalAnalogConfigNum numConfigSet;
-    const rfalAnalogConfigRegAddrMaskVal *configTbl;
-    ReturnCode retCode = ERR_NONE;
-    rfalAnalogConfigNum i;
+    const rfalAnalogConfigCompiledSet *set;
+    ReturnCode                        retCode;
     
     if (true != gRfalAnalogConfigMgmt.ready)
     {
         return ERR_REQUEST;
     }
     
-    /* Search LUT for the specific Configuration ID. */
-    while(true)
+    /* Use the compiled register changes of this Configuration ID, compiling them on first use */
+    set = rfalAnalogConfigCompile( configId );
+    
+    /* Chip events other than Poll/Listen common may overwrite the settings of a mode */
+    if( (RFAL_ANALOG_CONFIG_ID_GET_TECH(configId) == RFAL_ANALOG_CONFIG_TECH_CHIP)                                  &&
+        ((configId & RFAL_ANALOG_CONFIG_CHIP_SPECIFIC_MASK) != RFAL_ANALOG_CONFIG_CHIP_POLL_COMMON)                 &&
+        ((configId & RFAL_ANALOG_CONFIG_CHIP_SPECIFIC_MASK) != RFAL_ANALOG_CONFIG_CHIP_LISTEN_COMMON)               &&
+        ((set == NULL) || (set->num > 0U))                                                                              )
     {
-        numConfigSet = rfalAnalogConfigSearch(configId, &configOffset);
-        if( RFAL_ANALOG_CONFIG_LUT_NOT_FOUND == numConfigSet )
-        {
-            break;
-        }
-        
-        configTbl = (rfalAnalogConfigRegAddrMaskVal *)( (uint32_t)gRfalAnalogConfigMgmt.currentAnalogConfigTbl + (uint32_t)configOffset); 
-        /* Increment the offset to the next index to search from. */
-        configOffset += (uint16_t)(numConfigSet * sizeof(rfalAnalogConfigRegAddrMaskVal)); 
-        
-        if ((gRfalAnalogConfigMgmt.configTblSize + 1U) < configOffset)
-        {   /* Error check make sure that the we do not access outside the configuration Table Size */
-            return ERR_NOMEM;
-        }
-        
-        for ( i = 0; i < numConfigSet; i++)
-        {
-            if( (GETU16(configTbl[i].addr) & RFAL_TEST_REG) != 0U )
-            {
-                EXIT_ON_ERR(retCode, rfalChipChangeTestRegBits( (GETU16(configTbl[i].addr) & ~RFAL_TEST_REG), configTbl[i].mask, configTbl[i].val) );
-            }
-            else
-            {
-                EXIT_ON_ERR(retCode, rfalChipChangeRegBits( GETU16(configTbl[i].addr), configTbl[i].mask, configTbl[i].val) );
-            }
-        }
-        
-    } /* while(found Analog Config Id) */
+        gRfalAnalogConfigMgmt.generation++;
+    }
+    
+    if( set != NULL )
+    {
+        retCode = rfalAnalogConfigApplyCompiled( set );
+    }
+    else
+    {
+        /* No room to compile it, apply the settings straight from the Table */
+        retCode = rfalAnalogConfigApply( configId );
+    }
+    
+    /* Settings only partly applied, the ones relying on this generation are no longer in place */
+    if( retCode != ERR_NONE )
+    {
+        gRfalAnalogConfigMgmt.generation++;
+    }
     
     return retCode;
     
 } /* rfalSetAnalogConfig() */
 
 
+uint16_t rfalAnalogConfigGetGeneration( void )
+{
+    return gRfalAnalogConfigMgmt.generation;
+} /* rfalAnalogConfigGetGeneration() */
+
+
 uint16_t rfalAnalogConfigGenModeID( rfalMode md, rfalBitRate br, uint16_t dir )
 {
     uint16_t id;
@@ -417,12 +460,335 @@ static void rfalAnalogConfigPtrUpdate( const uint8_t* analogConfigTbl )
 {
 
     gRfalAnalogConfigMgmt.currentAnalogConfigTbl = analogConfigTbl;
+    
+    /* Configurations compiled from the previous Table are no longer valid */
+    gRfalAnalogConfigMgmt.compiled.setsNum = 0;
+    gRfalAnalogConfigMgmt.compiled.regsNum = 0;
+    rfalAnalogConfigIndexBuild();
+    gRfalAnalogConfigMgmt.generation++;
     gRfalAnalogConfigMgmt.ready = true;
     
 } /* rfalAnalogConfigPtrUpdate() */
 #endif /* RFAL_FEATURE_DYNAMIC_ANALOG_CONFIG */
 
 
+/*! 
+ *****************************************************************************
+ * \brief  Apply the Analog Configuration settings of a Configuration ID
+ *  
+ * Applies the Register-Mask-Value sets of all entries matching the 
+ * Configuration ID, in the order they are found in the Table.
+ * 
+ * \param[in]  configId: Configuration ID to apply.
+ * 
+ * \return ERR_NOMEM : Table inconsistent with its size
+ * \return ERR_PARAM : Invalid register on the Table
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+static ReturnCode rfalAnalogConfigApply( rfalAnalogConfigId configId )
+{
+    rfalAnalogConfigOffset configOffset = 0;
+    rfalAnalogConfigNum numConfigSet;
+    const rfalAnalogConfigRegAddrMaskVal *configTbl;
+    ReturnCode retCode = ERR_NONE;
+    rfalAnalogConfigNum i;
+    
+    /* Search LUT for the specific Configuration ID. */
+    while(true)
+    {
+        numConfigSet = rfalAnalogConfigSearch(configId, &configOffset);
+        if( RFAL_ANALOG_CONFIG_LUT_NOT_FOUND == numConfigSet )
+        {
+            break;
+        }
+        
+        configTbl = (const rfalAnalogConfigRegAddrMaskVal *)&gRfalAnalogConfigMgmt.currentAnalogConfigTbl[configOffset];
+        /* Increment the offset to the next index to search from. */
+        configOffset += (uint16_t)(numConfigSet * sizeof(rfalAnalogConfigRegAddrMaskVal)); 
+        
+        if ((gRfalAnalogConfigMgmt.configTblSize + 1U) < configOffset)
+        {   /* Error check make sure that the we do not access outside the configuration Table Size */
+            return ERR_NOMEM;
+        }
+        
+        for ( i = 0; i < numConfigSet; i++)
+        {
+            if( (GETU16(configTbl[i].addr) & RFAL_TEST_REG) != 0U )
+            {
+                EXIT_ON_ERR(retCode, rfalChipChangeTestRegBits( (GETU16(configTbl[i].addr) & ~RFAL_TEST_REG), configTbl[i].mask, configTbl[i].val) );
+            }
+            else
+            {
+                EXIT_ON_ERR(retCode, rfalChipChangeRegBits( GETU16(configTbl[i].addr), configTbl[i].mask, configTbl[i].val) );
+            }
+        }
+        
+    } /* while(found Analog Config Id) */
+    
+    return retCode;
+    
+} /* rfalAnalogConfigApply() */
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Compile the Analog Configuration settings of a Configuration ID
+ *  
+ * Gathers the Register-Mask-Value sets of all entries matching the 
+ * Configuration ID into a list of register changes, in Table order as the
+ * write sequence may matter. Only back to back changes on the same register
+ * are merged, runs of consecutive addresses are written at once on apply.
+ * The list is kept until the Table is changed.
+ * 
+ * \param[in]  configId: Configuration ID to compile.
+ * 
+ * \return the compiled Configuration ID
+ * \return NULL if there is no room left to keep it, or the Table is inconsistent
+ *****************************************************************************
+ */
+static const rfalAnalogConfigCompiledSet* rfalAnalogConfigCompile( rfalAnalogConfigId configId )
+{
+    rfalAnalogConfigCompiled *cmp;
+    rfalAnalogConfigCompiledSet *set;
+    rfalAnalogConfigOffset configOffset;
+    rfalAnalogConfigNum numConfigSet;
+    const rfalAnalogConfigRegAddrMaskVal *configTbl;
+    uint16_t first;
+    uint16_t num;
+    uint16_t addr;
+    uint8_t  mask;
+    uint16_t i;
+    uint16_t j;
+    rfalAnalogConfigNum k;
+    
+    cmp = &gRfalAnalogConfigMgmt.compiled;
+    
+    /* Check whether it has already been compiled */
+    for( i = 0; i < cmp->setsNum; i++ )
+    {
+        if( cmp->sets[i].configId == configId )
+        {
+            return &cmp->sets[i];
+        }
+    }
+    
+    if( cmp->setsNum >= RFAL_ANALOG_CONFIG_COMPILED_SETS )
+    {
+        return NULL;
+    }
+    
+    /* Register changes are appended after the ones already compiled */
+    first        = cmp->regsNum;
+    num          = 0;
+    configOffset = 0;
+    
+    while(true)
+    {
+        numConfigSet = rfalAnalogConfigSearch(configId, &configOffset);
+        if( RFAL_ANALOG_CONFIG_LUT_NOT_FOUND == numConfigSet )
+        {
+            break;
+        }
+        
+        configTbl     = (const rfalAnalogConfigRegAddrMaskVal *)&gRfalAnalogConfigMgmt.currentAnalogConfigTbl[configOffset];
+        configOffset += (uint16_t)(numConfigSet * sizeof(rfalAnalogConfigRegAddrMaskVal));
+        
+        if ((gRfalAnalogConfigMgmt.configTblSize + 1U) < configOffset)
+        {   /* Do not access outside the configuration Table Size */
+            return NULL;
+        }
+        
+        for( k = 0; k < numConfigSet; k++ )
+        {
+            addr = GETU16(configTbl[k].addr);
+            mask = configTbl[k].mask;
+            
+            j = (first + num);
+            
+            if( (num > 0U) && (cmp->addr[j - 1U] == addr) )
+            {
+                /* Same register as the previous setting: merge, this setting overrides it */
+                cmp->val[j - 1U]   = (uint8_t)((cmp->val[j - 1U] & ~mask) | (configTbl[k].val & mask));
+                cmp->mask[j - 1U] |= mask;
+                continue;
+            }
+            
+            if( j >= RFAL_ANALOG_CONFIG_COMPILED_REGS )
+            {
+                return NULL;
+            }
+            
+            cmp->addr[j] = addr;
+            cmp->mask[j] = mask;
+            cmp->val[j]  = (uint8_t)(configTbl[k].val & mask);
+            num++;
+        }
+    }
+    
+    set           = &cmp->sets[cmp->setsNum];
+    set->configId = configId;
+    set->first    = first;
+    set->num      = num;
+    
+    cmp->setsNum++;
+    cmp->regsNum += num;
+    
+    return set;
+    
+} /* rfalAnalogConfigCompile() */
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Apply a compiled Configuration ID
+ *  
+ * Applies the register changes of a compiled Configuration ID, consecutive
+ * registers with a single access, all of them on a single RF Chip batch.
+ * 
+ * \param[in]  set: compiled Configuration ID to apply.
+ * 
+ * \return ERR_PARAM : Invalid register on the Table
+ * \return ERR_IO    : Error on the RF Chip batch transfer
+ * \return ERR_NONE  : No error
+ *****************************************************************************
+ */
+static ReturnCode rfalAnalogConfigApplyCompiled( const rfalAnalogConfigCompiledSet *set )
+{
+    const rfalAnalogConfigCompiled *cmp;
+    ReturnCode retCode;
+    ReturnCode batchRet;
+    bool       batch;
+    uint16_t   i;
+    uint16_t   end;
+    uint8_t    len;
+    
+    cmp     = &gRfalAnalogConfigMgmt.compiled;
+    retCode = ERR_NONE;
+    
+    if( set->num == 0U )
+    {
+        return ERR_NONE;
+    }
+    
+    /* Group all the accesses, unless the caller has already a batch ongoing */
+    batch = (rfalChipBatchStart() == ERR_NONE);
+    
+    i   = set->first;
+    end = (set->first + set->num);
+    while( i < end )
+    {
+        if( (cmp->addr[i] & RFAL_TEST_REG) != 0U )
+        {
+            retCode = rfalChipChangeTestRegBits( (cmp->addr[i] & ~RFAL_TEST_REG), cmp->mask[i], cmp->val[i] );
+            len     = 1U;
+        }
+        else
+        {
+            /* Extend the run over the consecutive registers */
+            len = 1U;
+            while( ((i + len) < end) && (len < UINT8_MAX) && ((cmp->addr[i + len] & RFAL_TEST_REG) == 0U) && (cmp->addr[i + len] == (cmp->addr[i] + len)) )
+            {
+                len++;
+            }
+            
+            retCode = rfalChipChangeRegBitsMultiple( cmp->addr[i], &cmp->mask[i], &cmp->val[i], len );
+        }
+        
+        if( retCode != ERR_NONE )
+        {
+            break;
+        }
+        
+        i += len;
+    }
+    
+    if( batch )
+    {
+        /* Report a failing batch transfer unless an error is already reported */
+        batchRet = rfalChipBatchEnd();
+        retCode  = ((retCode != ERR_NONE) ? retCode : batchRet);
+    }
+    
+    return retCode;
+    
+} /* rfalAnalogConfigApplyCompiled() */
+
+
+/*! 
+ *****************************************************************************
+ * \brief  Build the index of the Analog Configuration LUT
+ *  
+ * Lists the Table entries per Poll/Listen mode and bit rate, keeping the 
+ * Table order, so that a search only goes through the entries that can 
+ * match. If the Table has more entries than RFAL_ANALOG_CONFIG_LUT_SIZE 
+ * or is inconsistent with its size, the index is not used.
+ * 
+ *****************************************************************************
+ */
+static void rfalAnalogConfigIndexBuild( void )
+{
+    rfalAnalogConfigIndex *idx;
+    const uint8_t *tbl;
+    uint8_t  count[RFAL_ANALOG_CONFIG_INDEX_BUCKETS];
+    uint8_t  entries;
+    uint8_t  key;
+    uint16_t i;
+    uint8_t  b;
+    
+    idx        = &gRfalAnalogConfigMgmt.index;
+    tbl        = gRfalAnalogConfigMgmt.currentAnalogConfigTbl;
+    idx->valid = false;
+    
+    ST_MEMSET( count, 0x00, sizeof(count) );
+    
+    /* First pass: count the entries of each bucket */
+    entries = 0;
+    i       = 0;
+    while( i < gRfalAnalogConfigMgmt.configTblSize )
+    {
+        if( (entries >= RFAL_ANALOG_CONFIG_LUT_SIZE) || ((i + sizeof(rfalAnalogConfigId) + sizeof(rfalAnalogConfigNum)) > gRfalAnalogConfigMgmt.configTblSize) )
+        {
+            return;
+        }
+        
+        count[RFAL_ANALOG_CONFIG_INDEX_KEY( GETU16(&tbl[i]) )]++;
+        entries++;
+        
+        i += (uint16_t)( sizeof(rfalAnalogConfigId) + sizeof(rfalAnalogConfigNum) + (tbl[i + sizeof(rfalAnalogConfigId)] * sizeof(rfalAnalogConfigRegAddrMaskVal)) );
+    }
+    
+    if( i != gRfalAnalogConfigMgmt.configTblSize )
+    {
+        return;
+    }
+    
+    /* Bucket boundaries */
+    idx->first[0] = 0;
+    for( b = 0; b < RFAL_ANALOG_CONFIG_INDEX_BUCKETS; b++ )
+    {
+        idx->first[b + 1U] = (uint8_t)(idx->first[b] + count[b]);
+        count[b]           = idx->first[b];
+    }
+    
+    /* Second pass: place the entries, in Table order within each bucket */
+    i = 0;
+    while( i < gRfalAnalogConfigMgmt.configTblSize )
+    {
+        key = RFAL_ANALOG_CONFIG_INDEX_KEY( GETU16(&tbl[i]) );
+        
+        idx->id[count[key]]     = GETU16(&tbl[i]);
+        idx->offset[count[key]] = i;
+        count[key]++;
+        
+        i += (uint16_t)( sizeof(rfalAnalogConfigId) + sizeof(rfalAnalogConfigNum) + (tbl[i + sizeof(rfalAnalogConfigId)] * sizeof(rfalAnalogConfigRegAddrMaskVal)) );
+    }
+    
+    idx->valid = true;
+    
+} /* rfalAnalogConfigIndexBuild() */
+
+
 /*! 
  *****************************************************************************
  * \brief  Search the Analog Configuration LUT for a specific Configuration ID.
@@ -443,6 +809,9 @@ static rfalAnalogConfigNum rfalAnalogConfigSearch( rfalAnalogConfigId configId,
     const uint8_t *configTbl;
     const uint8_t *currentConfigTbl;
     uint16_t i;
+    const rfalAnalogConfigIndex *idx;
+    uint8_t key;
+    uint8_t e;
     
     currentConfigTbl = gRfalAnalogConfigMgmt.currentAnalogConfigTbl;
     configIdMaskVal  = ((RFAL_ANALOG_CONFIG_POLL_LISTEN_MODE_MASK | RFAL_ANALOG_CONFIG_BITRATE_MASK) 
@@ -458,6 +827,24 @@ static rfalAnalogConfigNum rfalAnalogConfigSearch( rfalAnalogConfigId configId,
     }
     
     
+    /* Only go through the entries with the same mode and bit rate, in Table order */
+    if( gRfalAnalogConfigMgmt.index.valid )
+    {
+        idx = &gRfalAnalogConfigMgmt.index;
+        key = RFAL_ANALOG_CONFIG_INDEX_KEY( configId );
+        
+        for( e = idx->first[key]; e < idx->first[key + 1U]; e++ )
+        {
+            if( (idx->offset[e] >= *configOffset) && (configId == (idx->id[e] & configIdMaskVal)) )
+            {
+                *configOffset = (uint16_t)(idx->offset[e] + sizeof(rfalAnalogConfigId) + sizeof(rfalAnalogConfigNum));
+                return currentConfigTbl[idx->offset[e] + sizeof(rfalAnalogConfigId)];
+            }
+        }
+        
+        return RFAL_ANALOG_CONFIG_LUT_NOT_FOUND;
+    }
+    
     i = *configOffset;
     while (i < gRfalAnalogConfigMgmt.configTblSize)
     {
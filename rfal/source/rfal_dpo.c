@@ -75,12 +75,25 @@
  ******************************************************************************
  */
 
-static bool                gRfalDpoIsEnabled = false;
-static uint8_t*            gRfalCurrentDpo;
-static uint8_t             gRfalDpoTableEntries;
-static uint8_t             gRfalDpo[RFAL_DPO_TABLE_SIZE_MAX];
-static uint8_t             gRfalDpoTableEntry;
-static rfalDpoMeasureFunc  gRfalDpoMeasureCallback = NULL;
+/*! DPO context of an ST25R */
+typedef struct
+{
+    bool                isEnabled;
+    uint8_t*            currentDpo;
+    uint8_t             tableEntries;
+    uint8_t             dpo[RFAL_DPO_TABLE_SIZE_MAX];
+    uint8_t             tableEntry;
+    rfalDpoMeasureFunc  measureCallback;
+} rfalDpoCtx;
+
+static rfalDpoCtx          gRfalDpoInst[ST25R_MAX_INSTANCES];  /* DPO contexts, one per ST25R, disabled by default */
+
+#define gRfalDpoIsEnabled          (gRfalDpoInst[platformGetInstance()].isEnabled)
+#define gRfalCurrentDpo            (gRfalDpoInst[platformGetInstance()].currentDpo)
+#define gRfalDpoTableEntries       (gRfalDpoInst[platformGetInstance()].tableEntries)
+#define gRfalDpo                   (gRfalDpoInst[platformGetInstance()].dpo)
+#define gRfalDpoTableEntry         (gRfalDpoInst[platformGetInstance()].tableEntry)
+#define gRfalDpoMeasureCallback    (gRfalDpoInst[platformGetInstance()].measureCallback)
 
 /*
  ******************************************************************************
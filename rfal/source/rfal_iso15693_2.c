@@ -92,7 +92,10 @@
 * LOCAL VARIABLES
 ******************************************************************************
 */
-static iso15693PhyConfig_t iso15693PhyConfig; /*!< current phy configuration */
+static iso15693PhyConfig_t iso15693PhyConfigInst[ST25R_MAX_INSTANCES]; /*!< current phy configuration, one per ST25R */
+#define iso15693PhyConfig    (iso15693PhyConfigInst[platformGetInstance()]) /*!< current phy configuration of the caller */
+static struct iso15693StreamConfig iso15693StreamCfgInst[ST25R_MAX_INSTANCES]; /*!< stream configuration, one per ST25R */
+#define iso15693StreamCfg    (iso15693StreamCfgInst[platformGetInstance()]) /*!< stream configuration of the caller */
 
 /*
 ******************************************************************************
@@ -111,27 +114,23 @@ static ReturnCode iso15693PhyVCDCode1Of256(const uint8_t data, uint8_t* outbuffe
 */
 ReturnCode iso15693PhyConfigure(const iso15693PhyConfig_t* config, const struct iso15693StreamConfig ** needed_stream_config  )
 {
-    static struct iso15693StreamConfig stream_config = {                                       /* MISRA 8.9 */
-        .useBPSK = 0,              /* 0: subcarrier, 1:BPSK */
-        .din = 5,                  /* 2^5*fc = 423750 Hz: divider for the in subcarrier frequency */
-        .dout = 7,                 /*!< 2^7*fc = 105937 : divider for the in subcarrier frequency */
-        .report_period_length = 3, /*!< 8=2^3 the length of the reporting period */
-    };
-    
+    iso15693StreamCfg.useBPSK = 0;              /* 0: subcarrier, 1:BPSK */
+    iso15693StreamCfg.din     = 5;              /* 2^5*fc = 423750 Hz: divider for the in subcarrier frequency */
+    iso15693StreamCfg.dout    = 7;              /* 2^7*fc = 105937 : divider for the in subcarrier frequency */
     
     /* make a copy of the configuration */
     ST_MEMCPY( (uint8_t*)&iso15693PhyConfig, (const uint8_t*)config, sizeof(iso15693PhyConfig_t));
     
     if ( config->speedMode <= 3U)
     { /* If valid speed mode adjust report period accordingly */
-        stream_config.report_period_length = (3U - (uint8_t)config->speedMode);
+        iso15693StreamCfg.report_period_length = (3U - (uint8_t)config->speedMode);
     }
     else
     { /* If invalid default to normal (high) speed */
-        stream_config.report_period_length = 3;
+        iso15693StreamCfg.report_period_length = 3;   /* 8=2^3 the length of the reporting period */
     }
 
-    *needed_stream_config = &stream_config;
+    *needed_stream_config = &iso15693StreamCfg;
 
     return ERR_NONE;
 }
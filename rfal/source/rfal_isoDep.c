@@ -445,7 +445,8 @@ typedef struct{
  ******************************************************************************
  */
 
-static rfalIsoDep gIsoDep;    /*!< ISO-DEP Module instance               */
+static rfalIsoDep gIsoDepInst[ST25R_MAX_INSTANCES];        /*!< ISO-DEP Module instances, one per ST25R   */
+#define gIsoDep    (gIsoDepInst[platformGetInstance()])     /*!< ISO-DEP Module instance of the caller     */
 
 /*
  ******************************************************************************
@@ -1068,6 +1069,80 @@ ReturnCode rfalIsoDepDeselect( void )
     return ((cntRerun == 0U) ? ERR_TIMEOUT : ret);
 }
 
+
+/*******************************************************************************/
+ReturnCode rfalIsoDepPresenceCheck( void )
+{
+    ReturnCode ret;
+    uint8_t    txBuf[ISODEP_CONTROLMSG_BUF_LEN];
+    uint8_t    rxBuf[ISODEP_CONTROLMSG_BUF_LEN];
+    uint16_t   txLen;
+    uint16_t   rxLen;
+    uint8_t    pcb;
+    uint8_t    wtxm;
+    uint8_t    cntWtx;
+    uint32_t   fwt;
+    bool       hasDid;
+    
+    /*******************************************************************************/
+    /* R(NAK) with the PCD block number, which differs from the PICC one: the PICC *
+     * answers R(ACK) and keeps its state, no block is re-transmitted and the      *
+     * block numbers are not toggled                                               *
+     * ISO14443-4  7.5.4.3  Rule 12   Digital 2.0  16.2.6                         */
+    hasDid = ((gIsoDep.did != RFAL_ISODEP_NO_DID) || ((gIsoDep.did == RFAL_ISODEP_DID_00) && gIsoDep.lastDID00));
+    pcb    = isoDep_PCBRNAK( gIsoDep.blockNumber );
+    wtxm   = 0;
+    fwt    = (gIsoDep.fwt + gIsoDep.dFwt);
+    cntWtx = 0;
+    
+    do
+    {
+        txLen          = 0;
+        txBuf[txLen++] = (hasDid ? (pcb | ISODEP_PCB_DID_BIT) : pcb);
+        
+        if( hasDid )
+        {
+            txBuf[txLen++] = gIsoDep.did;
+        }
+        
+        if( wtxm != 0U )
+        {
+            txBuf[txLen++] = wtxm;                                        /* S(WTX) response with the requested WTXM */
+        }
+        
+        EXIT_ON_ERR( ret, rfalTransceiveBlockingTxRx( txBuf, txLen, rxBuf, (uint16_t)sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, fwt ) );
+        
+        if( rxLen < RFAL_ISODEP_PCB_LEN )
+        {
+            return ERR_PROTO;
+        }
+        
+        /* R(ACK) expected, a PICC re-transmitting its last I-Block is also present */
+        if( isoDep_PCBisRACK( rxBuf[0] ) || isoDep_PCBisIBlock( rxBuf[0] ) )
+        {
+            return ERR_NONE;
+        }
+        
+        /* The PICC may request more time to answer the R(NAK)   Digital 2.0  16.2.6.5 */
+        if( !isoDep_PCBisSWTX( rxBuf[0] ) )
+        {
+            return ERR_PROTO;
+        }
+        
+        wtxm = isoDep_GetWTXM( rxBuf[rxLen - 1U] );
+        if( !isoDep_isWTXMValid( wtxm ) )
+        {
+            return ERR_PROTO;
+        }
+        
+        pcb = ISODEP_PCB_SWTX;
+        fwt = (MIN( RFAL_ISODEP_MAX_FWT, (gIsoDep.fwt * wtxm) ) + gIsoDep.dFwt);
+    }
+    while( cntWtx++ < gIsoDep.maxRetriesSnWTX );
+    
+    return ERR_PROTO;
+}
+
 #endif /* RFAL_FEATURE_ISO_DEP_POLL */
 
 
@@ -50,6 +50,7 @@
  ******************************************************************************
  */
 #include "rfal_nfc.h"
+#include "rfal_t2t.h"
 #include "utils.h"
 #include "rfal_analogConfig.h"
 
@@ -59,7 +60,19 @@
 * GLOBAL DEFINES
 ******************************************************************************
 */
-#define RFAL_NFC_MAX_DEVICES          5U    /* Max number of devices supported */
+#ifndef RFAL_NFC_MAX_DEVICES
+#define RFAL_NFC_MAX_DEVICES          5U    /* Max number of devices on the internal device table */
+#endif
+
+#ifndef RFAL_NFC_DEMOTED_POLL_PERIOD
+#define RFAL_NFC_DEMOTED_POLL_PERIOD  8U    /* A demoted technology is polled once every this number of cycles */
+#endif
+
+#ifndef RFAL_NFC_RESELECT_CACHE_LEN
+#define RFAL_NFC_RESELECT_CACHE_LEN   4U    /* Number of activated devices kept by the reselect cache */
+#endif
+
+#define RFAL_NFC_POLL_TECH_NUM        6U    /* Number of poller technologies, see RFAL_NFC_POLL_TECH_A .. ST25TB */
 
 
 /*
@@ -70,6 +83,9 @@
 
 #define rfalNfcNfcNotify( st )         if( gNfcDev.disc.notifyCb != NULL )  gNfcDev.disc.notifyCb( st )
 
+/* Collision Resolution list of a technology: the free tail of the device table, see rfalNfcPollCollStore() */
+#define rfalNfcPollCollList( type )    ((type*)((void*)&gNfcDev.devList[gNfcDev.devCnt]))   /*  PRQA S 0310 # MISRA 11.3 - Device table tail reused as listen device list, alignment is the device one */
+
 
 /*
 ******************************************************************************
@@ -84,6 +100,19 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be
 }rfalNfcTmpBuffer;
 
 
+/*! Reselect cache entry, a device activated on a previous discovery                                                  */
+typedef struct{
+    rfalNfcDevType          type;                     /*!< Device's type                                          */
+    uint8_t                 uid[RFAL_NFCA_CASCADE_3_UID_LEN]; /*!< Device's UID/PUPI, the cache key           */
+    uint8_t                 uidLen;                   /*!< Device's UID/PUPI length                               */
+    union{  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be used concurrently, only one technology at a time */
+        rfalNfcaListenDevice nfca;                    /*!< NFC-A: SENS_RES, SEL_RES and NFCID1 of all cascade levels */
+        rfalNfcbListenDevice nfcb;                    /*!< NFC-B: SENSB_RES with the ATTRIB protocol parameters   */
+        rfalNfcvListenDevice nfcv;                    /*!< NFC-V: INVENTORY_RES                                   */
+    }dev;                                             /*!< Device's instance                                      */
+}rfalNfcCacheEntry;
+
+
 typedef struct{
     rfalNfcState            state;              /* Main state                                      */
     uint16_t                techsFound;         /* Technologies found bitmask                      */
@@ -92,10 +121,13 @@ typedef struct{
     uint8_t                 selDevIdx;          /* Selected device index                           */
     rfalNfcDevice           *activeDev;         /* Active device pointer                           */
     rfalNfcDiscoverParam    disc;               /* Discovery parameters                            */
-    rfalNfcDevice           devList[RFAL_NFC_MAX_DEVICES];   /*!< Location of device list          */
+    rfalNfcDevice           *devList;           /* Device table in use, devLimit entries           */
+    rfalNfcDevice           devTable[RFAL_NFC_MAX_DEVICES]; /* Internal device table               */
     uint8_t                 devCnt;             /* Decices found counter                           */
     uint32_t                discTmr;            /* Discovery Total duration timer                  */
     ReturnCode              dataExErr;          /* Last Data Exchange error                        */
+    rfalTransceiveCallback  dataExCb;           /* Data Exchange completion callback               */
+    void                    *dataExCbParam;     /* User pointer passed to the completion callback  */
     bool                    discRestart;        /* Restart discover after deactivation flag        */
     bool                    isRxChaining;       /* Flag indicating Other device is chaining        */
     uint32_t                lmMask;             /* Listen Mode mask                                */
@@ -105,6 +137,21 @@ typedef struct{
     rfalNfcBuffer           txBuf;              /* Tx buffer for Data Exchange                     */
     rfalNfcBuffer           rxBuf;              /* Rx buffer for Data Exchange                     */
     uint16_t                rxLen;              /* Length of received data on Data Exchange        */
+    uint8_t                 collDevCnt;         /* Devices found by the tech Collision Resolution  */
+    
+    uint16_t                pollOrder[RFAL_NFC_POLL_TECH_NUM]; /* Technology Detection order        */
+    uint16_t                techsPolled;        /* Technologies scheduled on this polling cycle    */
+    uint32_t                pollHits[RFAL_NFC_POLL_TECH_NUM];  /* Hits on the last 32 cycles, 1 bit per cycle */
+    uint8_t                 pollMiss[RFAL_NFC_POLL_TECH_NUM];  /* Consecutive polls without a hit   */
+    uint8_t                 pollCycle;          /* Polling cycle counter                           */
+    
+    rfalNfcCacheEntry       cache[RFAL_NFC_RESELECT_CACHE_LEN]; /* Reselect cache, most recently used first */
+    uint8_t                 cacheCnt;           /* Devices on the reselect cache                   */
+    bool                    cacheHit;           /* Device found through the reselect cache         */
+    rfalNfcbSensbRes        nfcbDetRes;         /* SENSB_RES received on NFC-B Technology Detection */
+    uint8_t                 nfcbDetResLen;      /* NFC-B Technology Detection SENSB_RES length, 0: none received */
+    rfalNfcvInventoryRes    nfcvDetRes;         /* INVENTORY_RES received on NFC-V Technology Detection */
+    bool                    nfcvDetValid;       /* NFC-V Technology Detection INVENTORY_RES received */
     
 #if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
     rfalNfcTmpBuffer        tmpBuf;             /* Tmp buffer for Data Exchange                    */
@@ -119,18 +166,44 @@ typedef struct{
  ******************************************************************************
  */
 #ifdef RFAL_TEST_MODE
-    rfalNfc gNfcDev;
+    rfalNfc gNfcDevInst[ST25R_MAX_INSTANCES];
 #else /* RFAL_TEST_MODE */
-    static rfalNfc gNfcDev;
+    static rfalNfc gNfcDevInst[ST25R_MAX_INSTANCES];
 #endif /* RFAL_TEST_MODE */
 
+#define gNfcDev    (gNfcDevInst[platformGetInstance()])     /* NFC device context of the caller's instance */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTION PROTOTYPES
 ******************************************************************************
 */
+static void rfalNfcPollSchedule( void );
+static void rfalNfcPollUpdateStats( void );
+static uint16_t rfalNfcPollTechNext( void );
 static ReturnCode rfalNfcPollTechDetetection( void );
 static ReturnCode rfalNfcPollCollResolution( void );
+static void rfalNfcPollCollStore( rfalNfcDevType type, uint8_t devSize, uint8_t cnt );
+static bool rfalNfcGetDevUid( const rfalNfcDevice *dev, const uint8_t **uid, uint8_t *uidLen );
+static bool rfalNfcIsDevKnown( const rfalNfcDevice *dev );
+static void rfalNfcSetDevFoundCallbacks( bool enable );
+static bool rfalNfcDevFound( rfalNfcDevType type, const void *dev, uint8_t devSize );
+static uint8_t rfalNfcCacheFind( rfalNfcDevType type, const uint8_t *uid, uint8_t uidLen );
+static void rfalNfcCacheStore( const rfalNfcDevice *dev );
+static void rfalNfcCacheRemove( const rfalNfcDevice *dev );
+static bool rfalNfcCacheReselect( rfalNfcDevType type );
+#if RFAL_FEATURE_NFCA
+static bool rfalNfcNfcaDevFound( const rfalNfcaListenDevice *dev );
+#endif /* RFAL_FEATURE_NFCA */
+#if RFAL_FEATURE_NFCB
+static bool rfalNfcNfcbDevFound( const rfalNfcbListenDevice *dev );
+#endif /* RFAL_FEATURE_NFCB */
+#if RFAL_FEATURE_NFCF
+static bool rfalNfcNfcfDevFound( const rfalNfcfListenDevice *dev );
+#endif /* RFAL_FEATURE_NFCF */
+#if RFAL_FEATURE_NFCV
+static bool rfalNfcNfcvDevFound( const rfalNfcvListenDevice *dev );
+#endif /* RFAL_FEATURE_NFCV */
 static ReturnCode rfalNfcPollActivation( uint8_t devIt );
 static ReturnCode rfalNfcDeactivation( void );
 
@@ -148,7 +221,9 @@ ReturnCode rfalNfcInitialize( void )
 {
     ReturnCode err;
     
-    gNfcDev.state = RFAL_NFC_STATE_NOTINIT;
+    gNfcDev.state    = RFAL_NFC_STATE_NOTINIT;
+    gNfcDev.devList  = gNfcDev.devTable;
+    gNfcDev.cacheCnt = 0;
     
     rfalAnalogConfigInitialize();              /* Initialize RFAL's Analog Configs */
     EXIT_ON_ERR( err, rfalInitialize() );      /* Initialize RFAL */
@@ -157,6 +232,31 @@ ReturnCode rfalNfcInitialize( void )
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+void rfalNfcDefaultDiscParams( rfalNfcDiscoverParam *disParams )
+{
+    if( disParams == NULL )
+    {
+        return;
+    }
+    
+    ST_MEMSET( disParams, 0x00, sizeof(rfalNfcDiscoverParam) );
+    
+    disParams->compMode            = RFAL_COMPLIANCE_MODE_NFC;
+    disParams->techs2Find          = RFAL_NFC_TECH_NONE;
+    disParams->devLimit            = 1U;
+    disParams->devTable            = NULL;
+    disParams->maxBR               = RFAL_BR_KEEP;
+    disParams->nfcfBR              = RFAL_BR_212;
+    disParams->ap2pBR              = RFAL_BR_424;
+    disParams->notifyCb            = NULL;
+    disParams->devFoundCb          = NULL;
+    disParams->techDemoteCycles    = 0U;
+    disParams->fastReselect        = false;
+    disParams->wakeupEnabled       = false;
+    disParams->wakeupConfigDefault = true;
+}
+
 /*******************************************************************************/
 ReturnCode rfalNfcDiscover( const rfalNfcDiscoverParam *disParams )
 {
@@ -167,7 +267,7 @@ ReturnCode rfalNfcDiscover( const rfalNfcDiscoverParam *disParams )
     }
     
     /* Check valid parameters */
-    if( (disParams == NULL) || (disParams->devLimit > RFAL_NFC_MAX_DEVICES) || (disParams->devLimit == 0U)                                                 || 
+    if( (disParams == NULL) || (disParams->devLimit == 0U) || ((disParams->devTable == NULL) && (disParams->devLimit > RFAL_NFC_MAX_DEVICES))           || 
         ( (disParams->maxBR > RFAL_BR_1695) && (disParams->maxBR != RFAL_BR_KEEP) )                                                                        ||
         ( ((disParams->techs2Find & RFAL_NFC_POLL_TECH_F) != 0U)     && (disParams->nfcfBR != RFAL_BR_212) && (disParams->nfcfBR != RFAL_BR_424) )         ||
         ( (((disParams->techs2Find & RFAL_NFC_POLL_TECH_AP2P) != 0U) && (disParams->ap2pBR > RFAL_BR_424)) || (disParams->GBLen > RFAL_NFCDEP_GB_MAX_LEN) )  )
@@ -193,9 +293,16 @@ ReturnCode rfalNfcDiscover( const rfalNfcDiscoverParam *disParams )
     gNfcDev.activeDev       = NULL;
     gNfcDev.techsFound      = RFAL_NFC_TECH_NONE;
     gNfcDev.devCnt          = 0;
+    gNfcDev.devList         = ((disParams->devTable != NULL) ? disParams->devTable : gNfcDev.devTable);
     gNfcDev.discRestart     = true;
     gNfcDev.isTechInit      = false;
     gNfcDev.disc            = *disParams;
+    gNfcDev.pollCycle       = 0;
+    ST_MEMSET( gNfcDev.pollHits, 0x00, sizeof(gNfcDev.pollHits) );
+    ST_MEMSET( gNfcDev.pollMiss, 0x00, sizeof(gNfcDev.pollMiss) );
+    
+    /* Report the devices to the upper layer while they are resolved */
+    rfalNfcSetDevFoundCallbacks( (gNfcDev.disc.devFoundCb != NULL) );
     
     
     /* Calculate Listen Mask */
@@ -238,6 +345,7 @@ ReturnCode rfalNfcDeactivate( bool discovery )
     {
         /* Otherwise deactivate immediately and go to IDLE */
         rfalNfcDeactivation();
+        rfalNfcSetDevFoundCallbacks( false );
         gNfcDev.state = RFAL_NFC_STATE_IDLE;
     }
     
@@ -315,7 +423,8 @@ ReturnCode rfalNfcGetActiveDevice( rfalNfcDevice **dev )
 /*******************************************************************************/
 void rfalNfcWorker( void )
 {
-    ReturnCode err;
+    ReturnCode             err;
+    rfalTransceiveCallback dataExCb;
    
     rfalWorker();                                                                     /* Execute RFAL process  */
     
@@ -330,11 +439,15 @@ void rfalNfcWorker( void )
         case RFAL_NFC_STATE_START_DISCOVERY:
         
             /* Initialize context for discovery cycle */
-            gNfcDev.devCnt      = 0;
-            gNfcDev.selDevIdx   = 0;
-            gNfcDev.techsFound  = RFAL_NFC_TECH_NONE;
-            gNfcDev.techs2do    = gNfcDev.disc.techs2Find;
-            gNfcDev.state       = RFAL_NFC_STATE_POLL_TECHDETECT;
+            gNfcDev.devCnt        = 0;
+            gNfcDev.selDevIdx     = 0;
+            gNfcDev.cacheHit      = false;
+            gNfcDev.nfcbDetResLen = 0;
+            gNfcDev.nfcvDetValid  = false;
+            gNfcDev.techsFound    = RFAL_NFC_TECH_NONE;
+            gNfcDev.techs2do      = gNfcDev.disc.techs2Find;
+            gNfcDev.state         = RFAL_NFC_STATE_POLL_TECHDETECT;
+            rfalNfcPollSchedule();                                                    /* Set the technologies to poll and their order */
         
         #if RFAL_FEATURE_WAKEUP_MODE    
             /* Check if Low power Wake-Up is to be performed */
@@ -377,6 +490,8 @@ void rfalNfcWorker( void )
             err = rfalNfcPollTechDetetection();                                       /* Perform Technology Detection                         */
             if( err != ERR_BUSY )                                                     /* Wait until all technologies are performed            */
             {
+                rfalNfcPollUpdateStats();                                             /* Account the hits of this cycle                       */
+                
                 if( ( err != ERR_NONE) || (gNfcDev.techsFound == RFAL_NFC_TECH_NONE) )/* Check if any error occurred or no techs were found   */
                 {
                     rfalFieldOff();
@@ -429,10 +544,20 @@ void rfalNfcWorker( void )
             {
                 if( err != ERR_NONE )                                                     /* Activation failed selected device  */
                 {
+                    if( gNfcDev.cacheHit )                                                /* Reselected device not the cached one, fully resolve it next time */
+                    {
+                        rfalNfcCacheRemove( &gNfcDev.devList[gNfcDev.selDevIdx] );
+                    }
+                    
                     gNfcDev.state = RFAL_NFC_STATE_DEACTIVATION;                          /* If Activation failed, restart loop */
                     break;
                 }
                 
+                if( gNfcDev.disc.fastReselect )                                           /* Keep the activated device for a fast reselect */
+                {
+                    rfalNfcCacheStore( &gNfcDev.devList[gNfcDev.selDevIdx] );
+                }
+                
                 gNfcDev.state = RFAL_NFC_STATE_ACTIVATED;                                 /* Device has been properly activated */
                 rfalNfcNfcNotify( gNfcDev.state );                                        /* Inform upper layer that a device has been activated */
             }
@@ -454,6 +579,12 @@ void rfalNfcWorker( void )
                 gNfcDev.state = RFAL_NFC_STATE_LISTEN_SLEEP;                          /* Go to Listen Sleep state       */
                 rfalNfcNfcNotify( gNfcDev.state );                                    /* And notify caller              */
             }
+            if( (gNfcDev.dataExErr != ERR_BUSY) && (gNfcDev.dataExCb != NULL) )      /* Signal completion if requested */
+            {
+                dataExCb         = gNfcDev.dataExCb;
+                gNfcDev.dataExCb = NULL;                                              /* Consumed, may start next one   */
+                dataExCb( gNfcDev.dataExCbParam, gNfcDev.dataExErr );
+            }
             break;
             
             
@@ -551,6 +682,13 @@ void rfalNfcWorker( void )
 
 /*******************************************************************************/
 ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt )
+{
+    return rfalNfcDataExchangeStartCb( txData, txDataLen, rxData, rvdLen, fwt, NULL, NULL );
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalNfcDataExchangeStartCb( uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt, rfalTransceiveCallback cb, void *userParam )
 {
     ReturnCode            err;
     rfalTransceiveContext ctx;
@@ -673,8 +811,10 @@ ReturnCode rfalNfcDataExchangeStart( uint8_t *txData, uint16_t txDataLen, uint8_
         /* If a transceive has succesfully started flag Data Exchange as ongoing */
         if( err == ERR_NONE )
         {
-            gNfcDev.dataExErr = ERR_BUSY;
-            gNfcDev.state     = RFAL_NFC_STATE_DATAEXCHANGE;
+            gNfcDev.dataExErr     = ERR_BUSY;
+            gNfcDev.state         = RFAL_NFC_STATE_DATAEXCHANGE;
+            gNfcDev.dataExCb      = cb;
+            gNfcDev.dataExCbParam = userParam;
         }
         
         return err;
@@ -767,6 +907,342 @@ ReturnCode rfalNfcDataExchangeGetStatus( void )
     return gNfcDev.dataExErr;
 }
 
+/*******************************************************************************/
+ReturnCode rfalNfcPresenceCheck( uint32_t *latencyUs )
+{
+    ReturnCode           ret;
+    uint32_t             tStart;
+#if RFAL_FEATURE_NFCA
+    union{  /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be used concurrently, only one command at a time */
+    #if RFAL_FEATURE_T1T
+        rfalT1TRidRes    ridRes;
+    #endif /* RFAL_FEATURE_T1T */
+        uint8_t          t2tBuf[RFAL_T2T_READ_DATA_LEN];
+    }                    nfcaRes;
+  #if RFAL_FEATURE_T2T
+    uint16_t             rcvLen;
+  #endif /* RFAL_FEATURE_T2T */
+#endif /* RFAL_FEATURE_NFCA */
+#if RFAL_FEATURE_NFCB
+    rfalNfcbSensbRes     sensbRes;
+    uint8_t              sensbResLen;
+#endif /* RFAL_FEATURE_NFCB */
+#if RFAL_FEATURE_NFCF
+    rfalFeliCaPollRes    pollRes;
+    uint8_t              pollCnt;
+    uint8_t              pollColl;
+#endif /* RFAL_FEATURE_NFCF */
+#if RFAL_FEATURE_NFCV
+    rfalNfcvInventoryRes invRes;
+    uint16_t             invResLen;
+#endif /* RFAL_FEATURE_NFCV */
+#if RFAL_FEATURE_ST25TB
+    rfalSt25tbUID        st25tbUid;
+#endif /* RFAL_FEATURE_ST25TB */
+    
+    /* Check for valid state, no Data Exchange may be ongoing */
+    if( (gNfcDev.state != RFAL_NFC_STATE_ACTIVATED) && (gNfcDev.state != RFAL_NFC_STATE_DATAEXCHANGE_DONE) )
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    if( gNfcDev.activeDev == NULL )
+    {
+        return ERR_REQUEST;
+    }
+    
+    /* Only a remote Listener can be checked, a remote Poller drives the link itself */
+    if( !rfalNfcIsRemDevListener( gNfcDev.activeDev->type ) )
+    {
+        return ERR_NOTSUPP;
+    }
+    
+    ret    = ERR_NOTSUPP;
+    tStart = platformGetSysTickUs();
+    
+    /*******************************************************************************/
+    /* Protocol interfaces have their own check, leaving the protocol state intact */
+    switch( gNfcDev.activeDev->rfInterface )
+    {
+    #if RFAL_FEATURE_ISO_DEP_POLL
+        case RFAL_NFC_INTERFACE_ISODEP:
+            ret = rfalIsoDepPresenceCheck();                            /* R(NAK), answered with R(ACK)    */
+            break;
+    #endif /* RFAL_FEATURE_ISO_DEP_POLL */
+        
+    #if RFAL_FEATURE_NFC_DEP
+        case RFAL_NFC_INTERFACE_NFCDEP:
+            ret = rfalNfcDepPresenceCheck();                            /* S(ATN), answered with S(ATN)    */
+            break;
+    #endif /* RFAL_FEATURE_NFC_DEP */
+        
+        /*******************************************************************************/
+        /* RF interface: cheapest command the tag answers without leaving its state    */
+        case RFAL_NFC_INTERFACE_RF:
+            
+            switch( gNfcDev.activeDev->type )
+            {
+            #if RFAL_FEATURE_NFCA
+                case RFAL_NFC_LISTEN_TYPE_NFCA:
+                    
+                #if RFAL_FEATURE_T1T
+                    if( gNfcDev.activeDev->dev.nfca.type == RFAL_NFCA_T1T )
+                    {
+                        ret = rfalT1TPollerRid( &nfcaRes.ridRes );      /* RID                             */
+                    }
+                #endif /* RFAL_FEATURE_T1T */
+                
+                #if RFAL_FEATURE_T2T
+                    if( gNfcDev.activeDev->dev.nfca.type == RFAL_NFCA_T2T )
+                    {
+                        ret = rfalT2TPollerRead( 0, nfcaRes.t2tBuf, sizeof(nfcaRes.t2tBuf), &rcvLen );  /* READ block 0 */
+                    }
+                #endif /* RFAL_FEATURE_T2T */
+                    break;
+            #endif /* RFAL_FEATURE_NFCA */
+            
+            #if RFAL_FEATURE_NFCB
+                case RFAL_NFC_LISTEN_TYPE_NFCB:
+                    /* SENSB_REQ: answered by the device in READY_DECLARED, devices in HALT are not woken up */
+                    ret = rfalNfcbPollerCheckPresence( RFAL_NFCB_SENS_CMD_SENSB_REQ, RFAL_NFCB_SLOT_NUM_1, &sensbRes, &sensbResLen );
+                    if( (ret == ERR_NONE) && (ST_BYTECMP( sensbRes.nfcid0, gNfcDev.activeDev->dev.nfcb.sensbRes.nfcid0, RFAL_NFCB_NFCID0_LEN ) != 0) )
+                    {
+                        ret = ERR_NOTFOUND;
+                    }
+                    break;
+            #endif /* RFAL_FEATURE_NFCB */
+            
+            #if RFAL_FEATURE_NFCF
+                case RFAL_NFC_LISTEN_TYPE_NFCF:
+                    ret = rfalNfcfPollerPoll( RFAL_FELICA_1_SLOT, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, &pollRes, &pollCnt, &pollColl );  /* SENSF_REQ */
+                    if( (ret == ERR_NONE) && ((pollCnt == 0U) || (ST_BYTECMP( &pollRes[RFAL_NFCF_HEADER_LEN], gNfcDev.activeDev->dev.nfcf.sensfRes.NFCID2, RFAL_NFCF_NFCID2_LEN ) != 0)) )
+                    {
+                        ret = ERR_NOTFOUND;
+                    }
+                    break;
+            #endif /* RFAL_FEATURE_NFCF */
+            
+            #if RFAL_FEATURE_NFCV
+                case RFAL_NFC_LISTEN_TYPE_NFCV:
+                    /* INVENTORY masked with the whole UID, only the active device may answer */
+                    ret = rfalNfcvPollerInventory( RFAL_NFCV_NUM_SLOTS_1, (uint8_t)(RFAL_NFCV_UID_LEN * 8U), gNfcDev.activeDev->dev.nfcv.InvRes.UID, &invRes, &invResLen );
+                    if( (ret == ERR_NONE) && (ST_BYTECMP( invRes.UID, gNfcDev.activeDev->dev.nfcv.InvRes.UID, RFAL_NFCV_UID_LEN ) != 0) )
+                    {
+                        ret = ERR_NOTFOUND;
+                    }
+                    break;
+            #endif /* RFAL_FEATURE_NFCV */
+            
+            #if RFAL_FEATURE_ST25TB
+                case RFAL_NFC_LISTEN_TYPE_ST25TB:
+                    ret = rfalSt25tbPollerGetUID( &st25tbUid );                 /* GET_UID                         */
+                    if( (ret == ERR_NONE) && (ST_BYTECMP( st25tbUid, gNfcDev.activeDev->dev.st25tb.UID, RFAL_ST25TB_UID_LEN ) != 0) )
+                    {
+                        ret = ERR_NOTFOUND;
+                    }
+                    break;
+            #endif /* RFAL_FEATURE_ST25TB */
+            
+                default:
+                    ret = ERR_NOTSUPP;
+                    break;
+            }
+            break;
+            
+        default:
+            ret = ERR_NOTSUPP;
+            break;
+    }
+    
+    if( latencyUs != NULL )
+    {
+        *latencyUs = (platformGetSysTickUs() - tStart);
+    }
+    
+    return ret;
+}
+
+/*!
+ ******************************************************************************
+ * \brief Get the statistics index of a poller technology
+ * 
+ * \param[in]  tech : poller technology flag, RFAL_NFC_POLL_TECH_A .. ST25TB
+ * 
+ * \return the technology index, its bit position on the flags
+ ******************************************************************************
+ */
+static uint8_t rfalNfcPollTechIdx( uint16_t tech )
+{
+    uint8_t i;
+    
+    for( i = 0; i < (RFAL_NFC_POLL_TECH_NUM - 1U); i++ )
+    {
+        if( tech == (uint16_t)(1U << i) )
+        {
+            break;
+        }
+    }
+    
+    return i;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Get the hits of a poller technology on the last 32 cycles
+ * 
+ * \param[in]  tech : poller technology flag
+ * 
+ * \return number of polling cycles on which the technology was found
+ ******************************************************************************
+ */
+static uint8_t rfalNfcPollHitCnt( uint16_t tech )
+{
+    uint32_t hist;
+    uint8_t  cnt;
+    
+    hist = gNfcDev.pollHits[rfalNfcPollTechIdx( tech )];
+    cnt  = 0;
+    
+    while( hist != 0U )
+    {
+        hist &= (hist - 1U);
+        cnt++;
+    }
+    
+    return cnt;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Schedule the Technology Detection of a polling cycle
+ * 
+ * Sets the polling order to the default one: AP2P, NFC-A, B, F, V and ST25TB.
+ * If techDemoteCycles is set, the passive technologies found most often on
+ * the last 32 cycles are polled first, ties keeping the default order. AP2P
+ * always stays first: once activated it ends the Technology Detection and
+ * no passive poll may follow on the active link. A technology
+ * not found on its last techDemoteCycles polls is demoted: it is only
+ * polled once every RFAL_NFC_DEMOTED_POLL_PERIOD cycles, till it is found
+ * again.
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcPollSchedule( void )
+{
+    /*******************************************************************************/
+    /* MISRA 8.9 An object should be defined at block scope if its identifier only appears in a single function */
+    const uint16_t defOrder[RFAL_NFC_POLL_TECH_NUM] = { RFAL_NFC_POLL_TECH_AP2P, RFAL_NFC_POLL_TECH_A, RFAL_NFC_POLL_TECH_B,
+                                                        RFAL_NFC_POLL_TECH_F, RFAL_NFC_POLL_TECH_V, RFAL_NFC_POLL_TECH_ST25TB };
+    /*******************************************************************************/
+    uint8_t  i;
+    uint8_t  j;
+    uint8_t  idx;
+    uint16_t tech;
+    
+    ST_MEMCPY( gNfcDev.pollOrder, defOrder, sizeof(gNfcDev.pollOrder) );
+    
+    if( gNfcDev.disc.techDemoteCycles != 0U )
+    {
+        gNfcDev.pollCycle++;
+        
+        /* Skip the demoted technologies, their periodic poll is staggered over the cycles */
+        for( i = 0; i < RFAL_NFC_POLL_TECH_NUM; i++ )
+        {
+            idx = rfalNfcPollTechIdx( defOrder[i] );
+            
+            if( (gNfcDev.pollMiss[idx] >= gNfcDev.disc.techDemoteCycles) && ((((uint32_t)gNfcDev.pollCycle + idx) % RFAL_NFC_DEMOTED_POLL_PERIOD) != 0U) )
+            {
+                gNfcDev.techs2do &= ~defOrder[i];
+            }
+        }
+        
+        /* Most found passive technologies first, AP2P kept at the head. Insertion sort keeps ties on the default order */
+        for( i = 2; i < RFAL_NFC_POLL_TECH_NUM; i++ )
+        {
+            tech = gNfcDev.pollOrder[i];
+            j    = i;
+            
+            while( (j > 1U) && (rfalNfcPollHitCnt( gNfcDev.pollOrder[j - 1U] ) < rfalNfcPollHitCnt( tech )) )
+            {
+                gNfcDev.pollOrder[j] = gNfcDev.pollOrder[j - 1U];
+                j--;
+            }
+            gNfcDev.pollOrder[j] = tech;
+        }
+    }
+    
+    gNfcDev.techsPolled = gNfcDev.techs2do;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Update the polling statistics at the end of Technology Detection
+ ******************************************************************************
+ */
+static void rfalNfcPollUpdateStats( void )
+{
+    uint8_t  i;
+    uint16_t tech;
+    uint16_t polled;
+    
+    if( gNfcDev.disc.techDemoteCycles == 0U )
+    {
+        return;
+    }
+    
+    /* Technologies effectively polled, AP2P activation may end detection earlier */
+    polled = (gNfcDev.techsPolled & (uint16_t)~gNfcDev.techs2do);
+    
+    for( i = 0; i < RFAL_NFC_POLL_TECH_NUM; i++ )
+    {
+        tech = (uint16_t)(1U << i);
+        
+        gNfcDev.pollHits[i] <<= 1U;
+        
+        if( (gNfcDev.techsFound & tech) != 0U )
+        {
+            gNfcDev.pollHits[i] |= 1U;
+            gNfcDev.pollMiss[i]  = 0;
+        }
+        else if( ((polled & tech) != 0U) && (gNfcDev.pollMiss[i] < UINT8_MAX) )
+        {
+            gNfcDev.pollMiss[i]++;
+        }
+        else
+        {
+            /* MISRA 15.7 - Empty else */
+        }
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Get the next technology to detect
+ * 
+ * \return the first technology of the polling order still to be performed,
+ *         RFAL_NFC_TECH_NONE if none
+ ******************************************************************************
+ */
+static uint16_t rfalNfcPollTechNext( void )
+{
+    uint8_t i;
+    
+    for( i = 0; i < RFAL_NFC_POLL_TECH_NUM; i++ )
+    {
+        if( (gNfcDev.techs2do & gNfcDev.pollOrder[i]) != 0U )
+        {
+            return gNfcDev.pollOrder[i];
+        }
+    }
+    
+    return RFAL_NFC_TECH_NONE;
+}
+
+
 /*!
  ******************************************************************************
  * \brief Poller Technology Detection
@@ -783,8 +1259,10 @@ ReturnCode rfalNfcDataExchangeGetStatus( void )
 static ReturnCode rfalNfcPollTechDetetection( void )
 {
     ReturnCode           err;
+    uint16_t             tech;
     
-    err = ERR_NONE;
+    err  = ERR_NONE;
+    tech = rfalNfcPollTechNext();                                                   /* Technology to detect, as per polling order */
     
     /* Supress warning when specific RFAL features have been disabled */
     NO_WARNING(err);   
@@ -793,7 +1271,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* AP2P Technology Detection                                                   */
     /*******************************************************************************/
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_AP2P) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_AP2P) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_AP2P )
     {
         
     #if RFAL_FEATURE_NFC_DEP
@@ -837,7 +1315,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* Passive NFC-A Technology Detection                                          */
     /*******************************************************************************/
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_A )
     {
         
     #if RFAL_FEATURE_NFCA
@@ -872,7 +1350,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* Passive NFC-B Technology Detection                                          */
     /*******************************************************************************/
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_B )
     {
     #if RFAL_FEATURE_NFCB
         
@@ -892,6 +1370,10 @@ static ReturnCode rfalNfcPollTechDetetection( void )
             if( err == ERR_NONE )
             {
                 gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_B;
+                
+                /* Keep the SENSB_RES for the reselect cache, its length is 0 on collision */
+                gNfcDev.nfcbDetRes    = sensbRes;
+                gNfcDev.nfcbDetResLen = sensbResLen;
             }
             
             gNfcDev.isTechInit = false;
@@ -906,7 +1388,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* Passive NFC-F Technology Detection                                          */
     /*******************************************************************************/
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_F )
     {
     #if RFAL_FEATURE_NFCF
      
@@ -938,7 +1420,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* Passive NFC-V Technology Detection                                          */
     /*******************************************************************************/
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_V )
     {
     #if RFAL_FEATURE_NFCV
         
@@ -957,6 +1439,10 @@ static ReturnCode rfalNfcPollTechDetetection( void )
             if( err == ERR_NONE )
             {
                 gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_V;
+                
+                /* Keep the INVENTORY_RES for the reselect cache, garbled on collision it matches no known device */
+                gNfcDev.nfcvDetRes   = invRes;
+                gNfcDev.nfcvDetValid = true;
             }
             
             gNfcDev.isTechInit = false;
@@ -972,7 +1458,7 @@ static ReturnCode rfalNfcPollTechDetetection( void )
     /*******************************************************************************/
     /* Passive Proprietary Technology ST25TB                                       */
     /*******************************************************************************/  
-    if( ((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_ST25TB) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_ST25TB) != 0U) )
+    if( tech == RFAL_NFC_POLL_TECH_ST25TB )
     {
     #if RFAL_FEATURE_ST25TB
         
@@ -1018,17 +1504,12 @@ static ReturnCode rfalNfcPollTechDetetection( void )
  */
 static ReturnCode rfalNfcPollCollResolution( void )
 {
-    uint8_t    i;
-    static uint8_t    devCnt;
     ReturnCode err;
     
     err    = ERR_NONE;
-    i      = 0;
     
     /* Supress warning when specific RFAL features have been disabled */
     NO_WARNING(err);
-    NO_WARNING(devCnt);
-    NO_WARNING(i);
     
     /* Check if device limit has been reached */
     if( gNfcDev.devCnt >= gNfcDev.disc.devLimit )
@@ -1042,8 +1523,6 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCA
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U) )   /* If a NFC-A device was found/detected, perform Collision Resolution */
     {
-        static rfalNfcaListenDevice nfcaDevList[RFAL_NFC_MAX_DEVICES];
-        
         if( !gNfcDev.isTechInit )
         {
             EXIT_ON_ERR( err, rfalNfcaPollerInitialize() );                            /* Initialize RFAL for NFC-A */
@@ -1060,7 +1539,14 @@ static ReturnCode rfalNfcPollCollResolution( void )
         
         if( !gNfcDev.isOperOngoing )
         {
-            EXIT_ON_ERR( err, rfalNfcaPollerStartFullCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcaDevList, &devCnt ) );
+            if( rfalNfcCacheReselect( RFAL_NFC_LISTEN_TYPE_NFCA ) )                    /* Known device selected by its NFCID1, no anticollision */
+            {
+                gNfcDev.isTechInit = false;
+                gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_A;
+                return ERR_BUSY;
+            }
+            
+            EXIT_ON_ERR( err, rfalNfcaPollerStartFullCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcPollCollList( rfalNfcaListenDevice ), &gNfcDev.collDevCnt ) );
          
             gNfcDev.isOperOngoing = true;
             return ERR_BUSY;
@@ -1072,14 +1558,9 @@ static ReturnCode rfalNfcPollCollResolution( void )
             gNfcDev.isTechInit = false;
             gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_A;
             
-            if( (err == ERR_NONE) && (devCnt != 0U) )
+            if( (err == ERR_NONE) && (gNfcDev.collDevCnt != 0U) )
             {
-                for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfca list into global device list */
-                {
-                    gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCA;
-                    gNfcDev.devList[gNfcDev.devCnt].dev.nfca = nfcaDevList[i];
-                    gNfcDev.devCnt++;
-                }
+                rfalNfcPollCollStore( RFAL_NFC_LISTEN_TYPE_NFCA, (uint8_t)sizeof(rfalNfcaListenDevice), gNfcDev.collDevCnt );
             }
         }
         
@@ -1093,7 +1574,11 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCB
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U) )   /* If a NFC-B device was found/detected, perform Collision Resolution */
     {
-        rfalNfcbListenDevice nfcbDevList[RFAL_NFC_MAX_DEVICES];
+        if( (!gNfcDev.isTechInit) && rfalNfcCacheReselect( RFAL_NFC_LISTEN_TYPE_NFCB ) ) /* Known device answered the Technology Detection, ATTRIB addressed by its PUPI */
+        {
+            gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_B;
+            return ERR_BUSY;
+        }
         
         if( !gNfcDev.isTechInit )
         {
@@ -1107,20 +1592,14 @@ static ReturnCode rfalNfcPollCollResolution( void )
             return ERR_BUSY;
         }
         
-        devCnt             = 0;
+        gNfcDev.collDevCnt = 0;
         gNfcDev.isTechInit = false;
         gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_B;
         
-        
-        err = rfalNfcbPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcbDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        err = rfalNfcbPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcPollCollList( rfalNfcbListenDevice ), &gNfcDev.collDevCnt );
+        if( (err == ERR_NONE) && (gNfcDev.collDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcb list into global device list */
-            {
-                gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCB;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcb = nfcbDevList[i];
-                gNfcDev.devCnt++;
-            }
+            rfalNfcPollCollStore( RFAL_NFC_LISTEN_TYPE_NFCB, (uint8_t)sizeof(rfalNfcbListenDevice), gNfcDev.collDevCnt );
         }
         
         return ERR_BUSY;
@@ -1133,8 +1612,6 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCF
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U) )  /* If a NFC-F device was found/detected, perform Collision Resolution */
     {
-        rfalNfcfListenDevice nfcfDevList[RFAL_NFC_MAX_DEVICES];
-        
         if( !gNfcDev.isTechInit )
         {
             EXIT_ON_ERR( err, rfalNfcfPollerInitialize( gNfcDev.disc.nfcfBR ));       /* Initialize RFAL for NFC-F */
@@ -1147,20 +1624,15 @@ static ReturnCode rfalNfcPollCollResolution( void )
             return ERR_BUSY;
         }
         
-        devCnt             = 0;
+        gNfcDev.collDevCnt = 0;
         gNfcDev.isTechInit = false;
         gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_F;
         
         
-        err = rfalNfcfPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcfDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        err = rfalNfcfPollerCollisionResolution( gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcPollCollList( rfalNfcfListenDevice ), &gNfcDev.collDevCnt );
+        if( (err == ERR_NONE) && (gNfcDev.collDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
-            {
-                gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCF;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcf = nfcfDevList[i];
-                gNfcDev.devCnt++;
-            }
+            rfalNfcPollCollStore( RFAL_NFC_LISTEN_TYPE_NFCF, (uint8_t)sizeof(rfalNfcfListenDevice), gNfcDev.collDevCnt );
         }
         
         return ERR_BUSY;
@@ -1173,7 +1645,11 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_NFCV
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U) )  /* If a NFC-V device was found/detected, perform Collision Resolution */
     {
-        rfalNfcvListenDevice nfcvDevList[RFAL_NFC_MAX_DEVICES];
+        if( (!gNfcDev.isTechInit) && rfalNfcCacheReselect( RFAL_NFC_LISTEN_TYPE_NFCV ) ) /* Known device answered the Technology Detection, addressed by its UID */
+        {
+            gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_V;
+            return ERR_BUSY;
+        }
         
         if( !gNfcDev.isTechInit )
         {
@@ -1187,20 +1663,14 @@ static ReturnCode rfalNfcPollCollResolution( void )
             return ERR_BUSY;
         }
         
-        devCnt             = 0;
+        gNfcDev.collDevCnt = 0;
         gNfcDev.isTechInit = false;
         gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_V;
         
-        
-        err = rfalNfcvPollerCollisionResolution( RFAL_COMPLIANCE_MODE_NFC, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcvDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        err = rfalNfcvPollerCollisionResolution( RFAL_COMPLIANCE_MODE_NFC, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcPollCollList( rfalNfcvListenDevice ), &gNfcDev.collDevCnt );
+        if( (err == ERR_NONE) && (gNfcDev.collDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
-            {
-                gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCV;
-                gNfcDev.devList[gNfcDev.devCnt].dev.nfcv = nfcvDevList[i];
-                gNfcDev.devCnt++;
-            }
+            rfalNfcPollCollStore( RFAL_NFC_LISTEN_TYPE_NFCV, (uint8_t)sizeof(rfalNfcvListenDevice), gNfcDev.collDevCnt );
         }
         
         return ERR_BUSY;
@@ -1213,8 +1683,6 @@ static ReturnCode rfalNfcPollCollResolution( void )
 #if RFAL_FEATURE_ST25TB
     if( ((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_ST25TB) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_ST25TB) != 0U) ) /* If a ST25TB device was found/detected, perform Collision Resolution */
     {
-        rfalSt25tbListenDevice st25tbDevList[RFAL_NFC_MAX_DEVICES];
-        
         if( !gNfcDev.isTechInit )
         {
             EXIT_ON_ERR( err, rfalSt25tbPollerInitialize() );                         /* Initialize RFAL for ST25TB */
@@ -1227,20 +1695,15 @@ static ReturnCode rfalNfcPollCollResolution( void )
             return ERR_BUSY;
         }
         
-        devCnt             = 0;
+        gNfcDev.collDevCnt = 0;
         gNfcDev.isTechInit = false;
         gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_ST25TB;
         
         
-        err = rfalSt25tbPollerCollisionResolution( (gNfcDev.disc.devLimit - gNfcDev.devCnt), st25tbDevList, &devCnt );
-        if( (err == ERR_NONE) && (devCnt != 0U) )
+        err = rfalSt25tbPollerCollisionResolution( (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcPollCollList( rfalSt25tbListenDevice ), &gNfcDev.collDevCnt );
+        if( (err == ERR_NONE) && (gNfcDev.collDevCnt != 0U) )
         {
-            for( i=0; i<devCnt; i++ )                                                 /* Copy devices found form local Nfcf list into global device list */
-            {
-                gNfcDev.devList[gNfcDev.devCnt].type       = RFAL_NFC_LISTEN_TYPE_ST25TB;
-                gNfcDev.devList[gNfcDev.devCnt].dev.st25tb = st25tbDevList[i];
-                gNfcDev.devCnt++;
-            }
+            rfalNfcPollCollStore( RFAL_NFC_LISTEN_TYPE_ST25TB, (uint8_t)sizeof(rfalSt25tbListenDevice), gNfcDev.collDevCnt );
         }
         
         return ERR_BUSY;
@@ -1251,6 +1714,502 @@ static ReturnCode rfalNfcPollCollResolution( void )
 }
 
 
+/*!
+ ******************************************************************************
+ * \brief Store the devices found by a technology Collision Resolution
+ * 
+ * The technology Collision Resolution places the devices found on the free
+ * tail of the device table (rfalNfcPollCollList), as the smaller listen
+ * device structs. They are expanded in place into device entries, starting
+ * from the last one so that no listen device gets overwritten before being
+ * moved. Devices already on the table (same type and UID) are then dropped.
+ *  
+ * \param[in]  type    : device type of the technology
+ * \param[in]  devSize : size of the technology listen device struct
+ * \param[in]  cnt     : number of devices found
+ * 
+ ******************************************************************************
+ */
+static void rfalNfcPollCollStore( rfalNfcDevType type, uint8_t devSize, uint8_t cnt )
+{
+    const uint8_t *collList;
+    uint8_t       i;
+    uint8_t       src;
+    
+    collList = (const uint8_t*)&gNfcDev.devList[gNfcDev.devCnt];
+    
+    for( i = cnt; i > 0U; i-- )
+    {
+        src = (gNfcDev.devCnt + i) - 1U;
+        ST_MEMMOVE( &gNfcDev.devList[src].dev, &collList[((uint32_t)i - 1U) * devSize], devSize );
+        gNfcDev.devList[src].type = type;
+    }
+    
+    /* Keep only the devices not yet on the table, packed after the ones already there */
+    src = gNfcDev.devCnt;
+    for( i = 0; i < cnt; i++ )
+    {
+        if( !rfalNfcIsDevKnown( &gNfcDev.devList[src] ) )
+        {
+            if( src != gNfcDev.devCnt )
+            {
+                gNfcDev.devList[gNfcDev.devCnt] = gNfcDev.devList[src];
+            }
+            gNfcDev.devCnt++;
+        }
+        src++;
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Get the UID of a device
+ *  
+ * \param[in]  dev    : device
+ * \param[out] uid    : location of the device UID
+ * \param[out] uidLen : length of the device UID
+ * 
+ * \return true  : UID retrieved
+ * \return false : Device type without UID
+ ******************************************************************************
+ */
+static bool rfalNfcGetDevUid( const rfalNfcDevice *dev, const uint8_t **uid, uint8_t *uidLen )
+{
+    switch( dev->type )
+    {
+    #if RFAL_FEATURE_NFCA
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            *uid    = dev->dev.nfca.nfcId1;
+            *uidLen = dev->dev.nfca.nfcId1Len;
+            break;
+    #endif /* RFAL_FEATURE_NFCA */
+    
+    #if RFAL_FEATURE_NFCB
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            *uid    = dev->dev.nfcb.sensbRes.nfcid0;
+            *uidLen = RFAL_NFCB_NFCID0_LEN;
+            break;
+    #endif /* RFAL_FEATURE_NFCB */
+    
+    #if RFAL_FEATURE_NFCF
+        case RFAL_NFC_LISTEN_TYPE_NFCF:
+            *uid    = dev->dev.nfcf.sensfRes.NFCID2;
+            *uidLen = RFAL_NFCF_NFCID2_LEN;
+            break;
+    #endif /* RFAL_FEATURE_NFCF */
+    
+    #if RFAL_FEATURE_NFCV
+        case RFAL_NFC_LISTEN_TYPE_NFCV:
+            *uid    = dev->dev.nfcv.InvRes.UID;
+            *uidLen = RFAL_NFCV_UID_LEN;
+            break;
+    #endif /* RFAL_FEATURE_NFCV */
+    
+    #if RFAL_FEATURE_ST25TB
+        case RFAL_NFC_LISTEN_TYPE_ST25TB:
+            *uid    = dev->dev.st25tb.UID;
+            *uidLen = RFAL_ST25TB_UID_LEN;
+            break;
+    #endif /* RFAL_FEATURE_ST25TB */
+    
+        default:
+            return false;
+    }
+    
+    return (*uidLen != 0U);
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Check whether a device is already on the device table
+ *  
+ * \param[in]  dev : device
+ * 
+ * \return true  : A device of the same type and UID is on the device table
+ * \return false : Device not on the device table, or without UID
+ ******************************************************************************
+ */
+static bool rfalNfcIsDevKnown( const rfalNfcDevice *dev )
+{
+    const uint8_t *uid;
+    const uint8_t *knownUid;
+    uint8_t       uidLen;
+    uint8_t       knownUidLen;
+    uint8_t       i;
+    
+    if( !rfalNfcGetDevUid( dev, &uid, &uidLen ) )
+    {
+        return false;
+    }
+    
+    for( i = 0; i < gNfcDev.devCnt; i++ )
+    {
+        if( (gNfcDev.devList[i].type == dev->type) && rfalNfcGetDevUid( &gNfcDev.devList[i], &knownUid, &knownUidLen ) )
+        {
+            if( (knownUidLen == uidLen) && (ST_BYTECMP( knownUid, uid, uidLen ) == 0) )
+            {
+                return true;
+            }
+        }
+    }
+    
+    return false;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Enable the device found callbacks of the technologies
+ *  
+ * \param[in]  enable : true to report the devices to the upper layer while
+ *                      they are resolved, false to disable it
+ ******************************************************************************
+ */
+static void rfalNfcSetDevFoundCallbacks( bool enable )
+{
+#if RFAL_FEATURE_NFCA
+    rfalNfcaPollerSetDevFoundCallback( (enable ? rfalNfcNfcaDevFound : NULL) );
+#endif /* RFAL_FEATURE_NFCA */
+    
+#if RFAL_FEATURE_NFCB
+    rfalNfcbPollerSetDevFoundCallback( (enable ? rfalNfcNfcbDevFound : NULL) );
+#endif /* RFAL_FEATURE_NFCB */
+    
+#if RFAL_FEATURE_NFCF
+    rfalNfcfPollerSetDevFoundCallback( (enable ? rfalNfcNfcfDevFound : NULL) );
+#endif /* RFAL_FEATURE_NFCF */
+    
+#if RFAL_FEATURE_NFCV
+    rfalNfcvPollerSetDevFoundCallback( (enable ? rfalNfcNfcvDevFound : NULL) );
+#endif /* RFAL_FEATURE_NFCV */
+    
+    NO_WARNING( enable );
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Report a device resolved by a technology to the upper layer
+ *  
+ * \param[in]  type    : device type of the technology
+ * \param[in]  dev     : technology listen device
+ * \param[in]  devSize : size of the technology listen device struct
+ * 
+ * \return true  : Device accepted, to be kept by the Collision Resolution
+ * \return false : Device rejected or already on the device table
+ ******************************************************************************
+ */
+static bool rfalNfcDevFound( rfalNfcDevType type, const void *dev, uint8_t devSize )
+{
+    rfalNfcDevice found;
+    
+    ST_MEMSET( &found, 0x00, sizeof(rfalNfcDevice) );
+    found.type = type;
+    ST_MEMCPY( &found.dev, dev, devSize );
+    
+    /* A device already on the table is dropped without reporting it again */
+    if( rfalNfcIsDevKnown( &found ) )
+    {
+        return false;
+    }
+    
+    return ( (gNfcDev.disc.devFoundCb == NULL) || gNfcDev.disc.devFoundCb( &found ) );
+}
+
+
+
+/*!
+ ******************************************************************************
+ * \brief Find a device on the reselect cache
+ *  
+ * \param[in]  type   : device type
+ * \param[in]  uid    : device UID/PUPI, NULL for the most recent device of type
+ * \param[in]  uidLen : device UID/PUPI length
+ * 
+ * \return the cache position of the device, cacheCnt if not found
+ ******************************************************************************
+ */
+static uint8_t rfalNfcCacheFind( rfalNfcDevType type, const uint8_t *uid, uint8_t uidLen )
+{
+    uint8_t i;
+    
+    for( i = 0; i < gNfcDev.cacheCnt; i++ )
+    {
+        if( (gNfcDev.cache[i].type == type) && ((uid == NULL) || ((gNfcDev.cache[i].uidLen == uidLen) && (ST_BYTECMP( gNfcDev.cache[i].uid, uid, uidLen ) == 0))) )
+        {
+            break;
+        }
+    }
+    
+    return i;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Store an activated device on the reselect cache
+ *  
+ * The device is placed first, as the most recently used one. A new device
+ * takes the place of the least recently used one when the cache is full.
+ * Only NFC-A (but T1T), NFC-B and NFC-V devices can be reselected.
+ * 
+ * \param[in]  dev : activated device
+ ******************************************************************************
+ */
+static void rfalNfcCacheStore( const rfalNfcDevice *dev )
+{
+    const uint8_t *uid;
+    uint8_t       uidLen;
+    uint8_t       i;
+    
+    if( (dev->type != RFAL_NFC_LISTEN_TYPE_NFCA) && (dev->type != RFAL_NFC_LISTEN_TYPE_NFCB) && (dev->type != RFAL_NFC_LISTEN_TYPE_NFCV) )
+    {
+        return;
+    }
+    
+    if( (dev->type == RFAL_NFC_LISTEN_TYPE_NFCA) && (dev->dev.nfca.type == RFAL_NFCA_T1T) )
+    {
+        return;                                                                       /* T1T has no SEL_REQ */
+    }
+    
+    if( !rfalNfcGetDevUid( dev, &uid, &uidLen ) || (uidLen > RFAL_NFCA_CASCADE_3_UID_LEN) )
+    {
+        return;
+    }
+    
+    i = rfalNfcCacheFind( dev->type, uid, uidLen );
+    if( i >= gNfcDev.cacheCnt )
+    {
+        if( gNfcDev.cacheCnt < RFAL_NFC_RESELECT_CACHE_LEN )
+        {
+            gNfcDev.cacheCnt++;
+        }
+        i = (gNfcDev.cacheCnt - 1U);
+    }
+    
+    /* Shift the more recent devices over the stored or dropped one */
+    ST_MEMMOVE( &gNfcDev.cache[1], &gNfcDev.cache[0], ((uint32_t)i * sizeof(rfalNfcCacheEntry)) );
+    
+    gNfcDev.cache[0].type   = dev->type;
+    gNfcDev.cache[0].uidLen = uidLen;
+    ST_MEMCPY( gNfcDev.cache[0].uid, uid, uidLen );
+    ST_MEMCPY( &gNfcDev.cache[0].dev, &dev->dev, sizeof(gNfcDev.cache[0].dev) );
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Remove a device from the reselect cache
+ *  
+ * \param[in]  dev : device
+ ******************************************************************************
+ */
+static void rfalNfcCacheRemove( const rfalNfcDevice *dev )
+{
+    const uint8_t *uid;
+    uint8_t       uidLen;
+    uint8_t       i;
+    
+    if( !rfalNfcGetDevUid( dev, &uid, &uidLen ) )
+    {
+        return;
+    }
+    
+    i = rfalNfcCacheFind( dev->type, uid, uidLen );
+    if( i < gNfcDev.cacheCnt )
+    {
+        gNfcDev.cacheCnt--;
+        ST_MEMMOVE( &gNfcDev.cache[i], &gNfcDev.cache[i + 1U], ((uint32_t)(gNfcDev.cacheCnt - i) * sizeof(rfalNfcCacheEntry)) );
+    }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Reselect a known device of a technology
+ *  
+ * Tries to reselect a device of the reselect cache instead of running the
+ * technology Collision Resolution:
+ *  NFC-A : ALL_REQ, then SEL_REQ with the NFCID1 of the most recent known
+ *          device with the same SENS_RES on each cascade level, the SDD_REQ
+ *          anticollision frames are skipped
+ *  NFC-B : the SENSB_RES received on the Technology Detection is taken as
+ *          is when it holds a known PUPI, no exchange is performed
+ *  NFC-V : the INVENTORY_RES received on the Technology Detection is taken
+ *          as is when it holds a known UID, no exchange is performed
+ * 
+ * At most one known device is tried per technology, chosen on the data
+ * already received, so that an unknown device costs no more than one 
+ * additional exchange (NFC-A) or none at all (NFC-B, NFC-V).
+ * 
+ * A device found is placed on the device table and the technology needs no
+ * Collision Resolution. Otherwise the Collision Resolution runs as usual.
+ * The reselect only applies when enabled, with NFC compliance and a single
+ * device to find: a SEL_REQ leaves the other NFC-A devices Idle.
+ * 
+ * \param[in]  type : device type of the technology
+ * 
+ * \return true  : Known device reselected
+ * \return false : No known device reselected, Collision Resolution required
+ ******************************************************************************
+ */
+static bool rfalNfcCacheReselect( rfalNfcDevType type )
+{
+    uint8_t              i;
+    bool                 hit;
+    uint8_t              devSize;
+#if RFAL_FEATURE_NFCA
+    rfalNfcaListenDevice *nfcaDev;
+    rfalNfcaSensRes      sensRes;
+#endif /* RFAL_FEATURE_NFCA */
+#if RFAL_FEATURE_NFCB
+    rfalNfcbListenDevice *nfcbDev;
+#endif /* RFAL_FEATURE_NFCB */
+#if RFAL_FEATURE_NFCV
+    rfalNfcvListenDevice *nfcvDev;
+#endif /* RFAL_FEATURE_NFCV */
+    ReturnCode           ret;
+    
+    if( (!gNfcDev.disc.fastReselect) || (gNfcDev.disc.devLimit != 1U) || (gNfcDev.disc.compMode != RFAL_COMPLIANCE_MODE_NFC) || (rfalNfcCacheFind( type, NULL, 0 ) >= gNfcDev.cacheCnt) )
+    {
+        return false;
+    }
+    
+    hit     = false;
+    devSize = 0;
+    ret     = ERR_NONE;
+    
+    /* Supress warning when specific RFAL features have been disabled */
+    NO_WARNING(ret);
+    
+    switch( type )
+    {
+    #if RFAL_FEATURE_NFCA
+        case RFAL_NFC_LISTEN_TYPE_NFCA:
+            
+            nfcaDev = rfalNfcPollCollList( rfalNfcaListenDevice );
+            devSize = (uint8_t)sizeof(rfalNfcaListenDevice);
+            
+            /* Wake the devices up, slept by the Technology Detection */
+            ret = rfalNfcaPollerCheckPresence( RFAL_14443A_SHORTFRAME_CMD_WUPA, &sensRes );
+            if( (ret != ERR_NONE) || rfalNfcaIsSensResT1T( &sensRes ) )
+            {
+                break;
+            }
+            
+            /* Only the most recent known device with the same SENS_RES is tried */
+            for( i = 0; i < gNfcDev.cacheCnt; i++ )
+            {
+                if( (gNfcDev.cache[i].type == RFAL_NFC_LISTEN_TYPE_NFCA) && (ST_BYTECMP( &gNfcDev.cache[i].dev.nfca.sensRes, &sensRes, sizeof(rfalNfcaSensRes) ) == 0) )
+                {
+                    break;
+                }
+            }
+            
+            if( i < gNfcDev.cacheCnt )
+            {
+                /* Only the device with this NFCID1 answers, the others go Idle */
+                *nfcaDev = gNfcDev.cache[i].dev.nfca;
+                
+                ret = rfalNfcaPollerSelect( nfcaDev->nfcId1, nfcaDev->nfcId1Len, &nfcaDev->selRes );
+                if( ret == ERR_NONE )
+                {
+                    hit = ( (nfcaDev->selRes.sak == gNfcDev.cache[i].dev.nfca.selRes.sak) && rfalNfcDevFound( type, nfcaDev, devSize ) );
+                }
+            }
+            
+            if( !hit )
+            {
+                rfalNfcaPollerSleep();                                                /* Unknown, unexpected or rejected device: sleep it, the Collision Resolution wakes it up */
+            }
+            break;
+    #endif /* RFAL_FEATURE_NFCA */
+    
+    #if RFAL_FEATURE_NFCB
+        case RFAL_NFC_LISTEN_TYPE_NFCB:
+            
+            nfcbDev = rfalNfcPollCollList( rfalNfcbListenDevice );
+            devSize = (uint8_t)sizeof(rfalNfcbListenDevice);
+            
+            /* The device which answered the Technology Detection is still Ready, a known PUPI is a hit */
+            if( (gNfcDev.nfcbDetResLen != 0U) && (rfalNfcCacheFind( type, gNfcDev.nfcbDetRes.nfcid0, RFAL_NFCB_NFCID0_LEN ) < gNfcDev.cacheCnt) )
+            {
+                nfcbDev->sensbRes    = gNfcDev.nfcbDetRes;
+                nfcbDev->sensbResLen = gNfcDev.nfcbDetResLen;
+                nfcbDev->isSleep     = false;
+                hit = rfalNfcDevFound( type, nfcbDev, devSize );
+            }
+            break;
+    #endif /* RFAL_FEATURE_NFCB */
+    
+    #if RFAL_FEATURE_NFCV
+        case RFAL_NFC_LISTEN_TYPE_NFCV:
+            
+            nfcvDev = rfalNfcPollCollList( rfalNfcvListenDevice );
+            devSize = (uint8_t)sizeof(rfalNfcvListenDevice);
+            
+            /* Only the known device which answered the Technology Detection is taken, its UID addresses it */
+            if( gNfcDev.nfcvDetValid && (rfalNfcCacheFind( type, gNfcDev.nfcvDetRes.UID, RFAL_NFCV_UID_LEN ) < gNfcDev.cacheCnt) )
+            {
+                nfcvDev->InvRes  = gNfcDev.nfcvDetRes;
+                nfcvDev->isSleep = false;
+                hit = rfalNfcDevFound( type, nfcvDev, devSize );
+            }
+            break;
+    #endif /* RFAL_FEATURE_NFCV */
+    
+        default:
+            /* MISRA 16.4: no empty default statement (a comment being enough) */
+            break;
+    }
+    
+    if( hit )
+    {
+        rfalNfcPollCollStore( type, devSize, 1U );
+        gNfcDev.cacheHit = true;
+    }
+    
+    return hit;
+}
+
+#if RFAL_FEATURE_NFCA
+/*******************************************************************************/
+static bool rfalNfcNfcaDevFound( const rfalNfcaListenDevice *dev )
+{
+    return rfalNfcDevFound( RFAL_NFC_LISTEN_TYPE_NFCA, dev, (uint8_t)sizeof(rfalNfcaListenDevice) );
+}
+#endif /* RFAL_FEATURE_NFCA */
+
+
+#if RFAL_FEATURE_NFCB
+/*******************************************************************************/
+static bool rfalNfcNfcbDevFound( const rfalNfcbListenDevice *dev )
+{
+    return rfalNfcDevFound( RFAL_NFC_LISTEN_TYPE_NFCB, dev, (uint8_t)sizeof(rfalNfcbListenDevice) );
+}
+#endif /* RFAL_FEATURE_NFCB */
+
+
+#if RFAL_FEATURE_NFCF
+/*******************************************************************************/
+static bool rfalNfcNfcfDevFound( const rfalNfcfListenDevice *dev )
+{
+    return rfalNfcDevFound( RFAL_NFC_LISTEN_TYPE_NFCF, dev, (uint8_t)sizeof(rfalNfcfListenDevice) );
+}
+#endif /* RFAL_FEATURE_NFCF */
+
+
+#if RFAL_FEATURE_NFCV
+/*******************************************************************************/
+static bool rfalNfcNfcvDevFound( const rfalNfcvListenDevice *dev )
+{
+    return rfalNfcDevFound( RFAL_NFC_LISTEN_TYPE_NFCV, dev, (uint8_t)sizeof(rfalNfcvListenDevice) );
+}
+#endif /* RFAL_FEATURE_NFCV */
+
+
 /*!
  ******************************************************************************
  * \brief Poller Activation
@@ -367,7 +367,8 @@ typedef struct{
  ******************************************************************************
  */
 
-static rfalNfcDep gNfcip;                    /*!< NFCIP module instance                         */
+static rfalNfcDep gNfcipInst[ST25R_MAX_INSTANCES];          /*!< NFCIP module instances, one per ST25R         */
+#define gNfcip    (gNfcipInst[platformGetInstance()])        /*!< NFCIP module instance of the caller           */
 
 
 /*
@@ -2197,6 +2198,70 @@ ReturnCode rfalNfcDepRLS( void )
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalNfcDepPresenceCheck( void )
+{
+    ReturnCode ret;
+    uint8_t    txBuf[RFAL_NFCDEP_DEPREQ_HEADER_LEN];
+    uint8_t    rxBuf[RFAL_NFCDEP_LEN_LEN + RFAL_NFCDEP_DEPREQ_HEADER_LEN];
+    uint8_t    rxMsgIt;
+    uint8_t    rxPFB;
+    uint16_t   rxLen;
+    uint8_t    *depRxBuf;
+    uint16_t   depRxBufLen;
+    uint16_t   *depRxRcvdLen;
+    
+    if( gNfcip.cfg.role == RFAL_NFCDEP_ROLE_TARGET )      /* Only the Initiator checks the presence */
+    {
+        return ERR_WRONG_STATE;
+    }
+    
+    /*******************************************************************************/
+    /* Attention (ATN) does not change the PNI, the Target answers with an ATN     *
+     * Digital 1.1  16.12.4.5 / 16.12.5.5                                         */
+    depRxBuf           = gNfcip.rxBuf;
+    depRxBufLen        = gNfcip.rxBufLen;
+    depRxRcvdLen       = gNfcip.rxRcvdLen;
+    
+    rxLen              = 0;
+    gNfcip.rxBuf       = rxBuf;
+    gNfcip.rxBufLen    = (uint16_t)sizeof(rxBuf);
+    gNfcip.rxRcvdLen   = &rxLen;
+    
+    ret = nfcipTx( NFCIP_CMD_DEP_REQ, txBuf, NULL, 0, nfcip_PFBSPDU_ATN(), (gNfcip.cfg.fwt + gNfcip.cfg.dFwt) );
+    if( ret == ERR_NONE )
+    {
+        ret = nfcipDataRx( true );
+    }
+    
+    /* Restore the Data Exchange buffers */
+    gNfcip.rxBuf       = depRxBuf;
+    gNfcip.rxBufLen    = depRxBufLen;
+    gNfcip.rxRcvdLen   = depRxRcvdLen;
+    
+    if( ret != ERR_NONE )
+    {
+        return ret;
+    }
+    
+    /*******************************************************************************/
+    rxMsgIt = RFAL_NFCDEP_LEN_LEN;
+    
+    if( (rxBuf[rxMsgIt++] != NFCIP_RES) || (rxBuf[rxMsgIt++] != (uint8_t)NFCIP_CMD_DEP_RES) )
+    {
+        return ERR_PROTO;
+    }
+    
+    rxPFB = rxBuf[rxMsgIt];
+    if( !nfcip_PFBisSATN( rxPFB ) )
+    {
+        return ERR_PROTO;
+    }
+    
+    return ERR_NONE;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcDepInitiatorHandleActivation( rfalNfcDepAtrParam* param, rfalBitRate desiredBR, rfalNfcDepDevice* nfcDepDev )
 {
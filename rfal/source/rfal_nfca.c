@@ -158,7 +158,8 @@ typedef struct{
 
 /*! RFAL NFC-A instance */
 typedef struct{
-    colResParams          CR;               /*!< Collision Resolution context                            */
+    colResParams             CR;            /*!< Collision Resolution context                            */
+    rfalNfcaDevFoundCallback devFoundCb;    /*!< Device found callback, NULL if not used                 */
 } rfalNfca;
 
 
@@ -174,7 +175,8 @@ typedef struct
 * LOCAL VARIABLES
 ******************************************************************************
 */
-static rfalNfca gNfca;  /*!< RFAL NFC-A instance  */
+static rfalNfca gNfcaInst[ST25R_MAX_INSTANCES];  /*!< RFAL NFC-A instances, one per ST25R  */
+#define gNfca    (gNfcaInst[platformGetInstance()]) /*!< RFAL NFC-A instance of the caller */
 
 /*
 ******************************************************************************
@@ -601,12 +603,16 @@ ReturnCode rfalNfcaPollerStartFullCollisionResolution( rfalComplianceMode compMo
         rfalT1TPollerInitialize();
         EXIT_ON_ERR( ret, rfalT1TPollerRid( &nfcaDevList->ridRes ) );
         
-        *devCnt = 1U;
         nfcaDevList->isSleep   = false;
         nfcaDevList->type      = RFAL_NFCA_T1T;
         nfcaDevList->nfcId1Len = RFAL_NFCA_CASCADE_1_UID_LEN;
         ST_MEMCPY( &nfcaDevList->nfcId1, &nfcaDevList->ridRes.uid, RFAL_NFCA_CASCADE_1_UID_LEN );
         
+        if( (gNfca.devFoundCb == NULL) || gNfca.devFoundCb( nfcaDevList ) )
+        {
+            *devCnt = 1U;
+        }
+        
         return ERR_NONE;
     }
     #endif /* RFAL_FEATURE_T1T */
@@ -620,6 +626,7 @@ ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void )
 {
     ReturnCode ret;
     uint8_t    newDevType;
+    bool       rejected;
     
     if( (gNfca.CR.nfcaDevList == NULL) || (gNfca.CR.devCnt == NULL) )
     {
@@ -643,7 +650,13 @@ ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void )
     /* PRQA S 4342 1 # MISRA 10.5 - Guaranteed that no invalid enum values are created: see guard_eq_RFAL_NFCA_T2T, .... */
     gNfca.CR.nfcaDevList[*gNfca.CR.devCnt].type    = (rfalNfcaListenDeviceType) newDevType;
     gNfca.CR.nfcaDevList[*gNfca.CR.devCnt].isSleep = false;
-    (*gNfca.CR.devCnt)++;
+    
+    /* Report the device while the resolution goes on, a rejected one is not counted */
+    rejected = ( (gNfca.devFoundCb != NULL) && !gNfca.devFoundCb( &gNfca.CR.nfcaDevList[*gNfca.CR.devCnt] ) );
+    if( !rejected )
+    {
+        (*gNfca.CR.devCnt)++;
+    }
 
     
     /* If a collision was detected and device counter is lower than limit  Activity 1.1  9.3.4.21 */
@@ -651,7 +664,10 @@ ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void )
     {
         /* Put this device to Sleep  Activity 1.1  9.3.4.22 */
         rfalNfcaPollerSleep();
-        gNfca.CR.nfcaDevList[(*gNfca.CR.devCnt - 1U)].isSleep = true;
+        if( !rejected )
+        {
+            gNfca.CR.nfcaDevList[(*gNfca.CR.devCnt - 1U)].isSleep = true;
+        }
         
         
         /* Send a new SENS_REQ to check for other cards  Activity 1.1  9.3.4.23 */
@@ -669,6 +685,12 @@ ReturnCode rfalNfcaPollerGetFullCollisionResolutionStatus( void )
     }
     else
     {
+        /* Keep a rejected device from answering to the following polls */
+        if( rejected )
+        {
+            rfalNfcaPollerSleep();
+        }
+        
         /* Exit loop */
         gNfca.CR.collPending = false;
     }
@@ -753,6 +775,13 @@ ReturnCode rfalNfcaPollerSleepFullCollisionResolution( uint8_t devLimit, rfalNfc
 }
 
 
+/*******************************************************************************/
+void rfalNfcaPollerSetDevFoundCallback( rfalNfcaDevFoundCallback pFunc )
+{
+    gNfca.devFoundCb = pFunc;
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalNfcaPollerSelect( const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes )
 {
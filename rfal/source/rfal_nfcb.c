@@ -128,8 +128,9 @@ typedef struct
 /*! RFAL NFC-B instance */
 typedef struct
 {
-    uint8_t  AFI;                            /*!< AFI to be used       */
-    uint8_t  PARAM;                          /*!< PARAM to be used     */
+    uint8_t                  AFI;            /*!< AFI to be used                          */
+    uint8_t                  PARAM;          /*!< PARAM to be used                        */
+    rfalNfcbDevFoundCallback devFoundCb;     /*!< Device found callback, NULL if not used */
 } rfalNfcb;
 
 /*
@@ -146,7 +147,8 @@ static ReturnCode rfalNfcbCheckSensbRes( const rfalNfcbSensbRes *sensbRes, uint8
 ******************************************************************************
 */
 
-static rfalNfcb gRfalNfcb; /*!< RFAL NFC-B Instance */
+static rfalNfcb gRfalNfcbInst[ST25R_MAX_INSTANCES];  /*!< RFAL NFC-B Instances, one per ST25R  */
+#define gRfalNfcb    (gRfalNfcbInst[platformGetInstance()]) /*!< RFAL NFC-B Instance of the caller */
 
 
 /*
@@ -412,7 +414,12 @@ ReturnCode rfalNfcbPollerSlottedCollisionResolution( rfalComplianceMode compMode
                         {
                             nfcbDevList[*devCnt].isSleep = false;
                             
-                            if( compMode == RFAL_COMPLIANCE_MODE_EMV )
+                            /* Report the device while the resolution goes on, a rejected one is put to sleep and not counted */
+                            if( (gRfalNfcb.devFoundCb != NULL) && !gRfalNfcb.devFoundCb( &nfcbDevList[*devCnt] ) )
+                            {
+                                rfalNfcbPollerSleep( nfcbDevList[*devCnt].sensbRes.nfcid0 );
+                            }
+                            else if( compMode == RFAL_COMPLIANCE_MODE_EMV )
                             {
                                 (*devCnt)++;
                                 return ret;
@@ -489,6 +496,13 @@ ReturnCode rfalNfcbPollerSlottedCollisionResolution( rfalComplianceMode compMode
 }
 
 
+/*******************************************************************************/
+void rfalNfcbPollerSetDevFoundCallback( rfalNfcbDevFoundCallback pFunc )
+{
+    gRfalNfcb.devFoundCb = pFunc;
+}
+
+
 /*******************************************************************************/
 uint32_t rfalNfcbTR2ToFDT( uint8_t tr2Code )
 {
@@ -125,7 +125,11 @@ typedef struct
 * LOCAL VARIABLES
 ******************************************************************************
 */
-static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collection */
+static rfalNfcfGreedyF gRfalNfcfGreedyFInst[ST25R_MAX_INSTANCES];   /*!< Activity's NFCF Greedy collection, one per ST25R */
+#define gRfalNfcfGreedyF    (gRfalNfcfGreedyFInst[platformGetInstance()]) /*!< NFCF Greedy collection of the caller      */
+
+static rfalNfcfDevFoundCallback gRfalNfcfDevFoundCbInst[ST25R_MAX_INSTANCES];   /*!< Device found callback, one per ST25R */
+#define gRfalNfcfDevFoundCb    (gRfalNfcfDevFoundCbInst[platformGetInstance()]) /*!< Device found callback of the caller  */
 
 
 /*
@@ -134,6 +138,7 @@ static rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collectio
 ******************************************************************************
 */
 static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound );
+static void rfalNfcfReportDevices( rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt );
 
 
 /*
@@ -217,6 +222,38 @@ static void rfalNfcfComputeValidSENF( rfalNfcfListenDevice *outDevInfo, uint8_t
     }
 }
 
+
+/*******************************************************************************/
+static void rfalNfcfReportDevices( rfalNfcfListenDevice *nfcfDevList, uint8_t *devCnt )
+{
+    uint8_t i;
+    uint8_t found;
+    
+    if( gRfalNfcfDevFoundCb == NULL )
+    {
+        return;
+    }
+    
+    /*******************************************************************************/
+    /* All the devices answer within the same Polling, report them once the list   */
+    /* is final and keep only the accepted ones, in the same order                  */
+    /*******************************************************************************/
+    found   = *devCnt;
+    *devCnt = 0;
+    
+    for( i = 0; i < found; i++ )
+    {
+        if( gRfalNfcfDevFoundCb( &nfcfDevList[i] ) )
+        {
+            if( i != *devCnt )
+            {
+                ST_MEMCPY( &nfcfDevList[*devCnt], &nfcfDevList[i], sizeof(rfalNfcfListenDevice) );
+            }
+            (*devCnt)++;
+        }
+    }
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -322,9 +359,18 @@ ReturnCode rfalNfcfPollerCollisionResolution( rfalComplianceMode compMode, uint8
       }
     }
     
+    rfalNfcfReportDevices( nfcfDevList, devCnt );
+    
     return ERR_NONE;
 }
 
+
+/*******************************************************************************/
+void rfalNfcfPollerSetDevFoundCallback( rfalNfcfDevFoundCallback pFunc )
+{
+    gRfalNfcfDevFoundCb = pFunc;
+}
+
 /*******************************************************************************/
 ReturnCode rfalNfcfPollerCheck( const uint8_t* nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvdLen )
 {
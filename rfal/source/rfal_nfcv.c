@@ -98,11 +98,16 @@
 
 
 
-/*! Time between slots - ISO 15693 defines t3min depending on modulation depth and data rate.
+/*! Time between slots when no complete INVENTORY_RES is received (us)
+ *  ISO 15693 defines t3min depending on modulation depth and data rate.
  *  With only high-bitrate supported, AM modulation and a length of 12 bytes (96bits) for INV_RES we get:
  *                    - ISO t3min = 96/26 ms + 300us = 4 ms
- *                    - NFC Forum defines FDTV,INVENT_NORES = (4394 + 2048)/fc. Digital 2.0  B.5*/
-#define RFAL_NFCV_FDT_V_INVENT_NORES      4U
+ *                    - NFC Forum defines FDTV,INVENT_NORES = (4394 + 2048)/fc = 475us. Digital 2.0  B.5
+ *  The ISO t3min includes the time of a whole INV_RES as the reader may send the next EOF right after 
+ *  the slot started. Here the wait only starts once the transceive is over: a timeout is only reported 
+ *  after the FWT elapsed with no SOF, any other result after the end of the received frame (I_rxe). 
+ *  No response is on air by then, the 300us of t3min are covered with a margin by the 475us used     */
+#define RFAL_NFCV_FDT_V_INVENT_NORES      (rfalConv1fcToUs( 4394U + 2048U ) + 1U)
 
 
 
@@ -156,12 +161,15 @@ typedef struct
 ******************************************************************************
 */
 static ReturnCode rfalNfcvParseError( uint8_t err );
+static bool rfalNfcvReportDevice( const rfalNfcvListenDevice *dev );
 
 /*
 ******************************************************************************
 * LOCAL VARIABLES
 ******************************************************************************
 */
+static rfalNfcvDevFoundCallback gRfalNfcvDevFoundCbInst[ST25R_MAX_INSTANCES];   /*!< Device found callback, one per ST25R */
+#define gRfalNfcvDevFoundCb    (gRfalNfcvDevFoundCbInst[platformGetInstance()]) /*!< Device found callback of the caller  */
 
 /*
 ******************************************************************************
@@ -189,6 +197,18 @@ static ReturnCode rfalNfcvParseError( uint8_t err )
     }
 }
 
+/*******************************************************************************/
+static bool rfalNfcvReportDevice( const rfalNfcvListenDevice *dev )
+{
+    /* Without callback all devices found are kept */
+    if( gRfalNfcvDevFoundCb == NULL )
+    {
+        return true;
+    }
+    
+    return gRfalNfcvDevFoundCb( dev );
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -311,7 +331,10 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
         }
         if( ret == ERR_NONE )     /* Device found without transmission error/collision    Activity 2.1  9.3.7.3 (Symbol 2)  */
         {
-            (*devCnt)++;
+            if( rfalNfcvReportDevice( nfcvDevList ) )
+            {
+                (*devCnt)++;
+            }
             return ERR_NONE;
         }
 
@@ -325,7 +348,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             return ERR_RF_COLLISION;
         }
 
-        platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+        platformDelayUs(RFAL_NFCV_FDT_V_INVENT_NORES);
 
         /*******************************************************************************/
         /* Collisions pending, Anticollision loop must be executed                     */
@@ -364,7 +387,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             {
                 if( rcvdLen < rfalConvBytesToBits(RFAL_NFCV_INV_RES_LEN + RFAL_NFCV_CRC_LEN) )
                 { /* If only a partial frame was received make sure the FDT_V_INVENT_NORES is fulfilled */
-                    platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+                    platformDelayUs(RFAL_NFCV_FDT_V_INVENT_NORES);
                 }
                 
                 /* Check if response is a correct frame (no TxRx error)  Activity 2.1  9.3.7.11  (Symbol 10)*/
@@ -374,7 +397,10 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
                     if( rfalNfcvCheckInvRes( nfcvDevList[(*devCnt)].InvRes.RES_FLAG, rcvdLen ) )
                     {
                         /* Activity 2.1  9.3.7.12  (Symbol 11) */
-                        (*devCnt)++;
+                        if( rfalNfcvReportDevice( &nfcvDevList[(*devCnt)] ) )
+                        {
+                            (*devCnt)++;
+                        }
                     }
                 }
                 else /* Treat everything else as collision */
@@ -405,7 +431,7 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
             else 
             { 
                 /* Timeout */
-                platformDelay(RFAL_NFCV_FDT_V_INVENT_NORES);
+                platformDelayUs(RFAL_NFCV_FDT_V_INVENT_NORES);
             }
             
             /* Check if devices found have reached device limit   Activity 2.1  9.3.7.13  (Symbol 12) */
@@ -421,6 +447,12 @@ ReturnCode rfalNfcvPollerCollisionResolution( rfalComplianceMode compMode, uint8
     return ERR_NONE;
 }
 
+/*******************************************************************************/
+void rfalNfcvPollerSetDevFoundCallback( rfalNfcvDevFoundCallback pFunc )
+{
+    gRfalNfcvDevFoundCb = pFunc;
+}
+
 /*******************************************************************************/
 ReturnCode rfalNfcvPollerSleepCollisionResolution( uint8_t devLimit, rfalNfcvListenDevice *nfcvDevList, uint8_t *devCnt )
 {
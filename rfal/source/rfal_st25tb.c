@@ -63,6 +63,7 @@
 #define RFAL_ST25TB_SLOTS            16U                                /*!< ST25TB number of slots                           */
 #define RFAL_ST25TB_SLOTNUM_MASK     0x0FU                              /*!< ST25TB Slot Number bit mask on SlotMarker        */
 #define RFAL_ST25TB_SLOTNUM_SHIFT    4U                                 /*!< ST25TB Slot Number shift on SlotMarker           */
+#define RFAL_ST25TB_T2               529U                               /*!< ST25TB t2 min: Answer to new request delay 7x2^10/fc = 528.6us */
 
 #define RFAL_ST25TB_INITIATE_CMD1    0x06U                              /*!< ST25TB Initiate command byte1                    */
 #define RFAL_ST25TB_INITIATE_CMD2    0x00U                              /*!< ST25TB Initiate command byte2                    */
@@ -171,7 +172,7 @@ static bool rfalSt25tbPollerDoCollisionResolution( uint8_t devLimit, rfalSt25tbL
     
     for(i = 0; i < RFAL_ST25TB_SLOTS; i++)
     {
-        platformDelay(1);  /* Wait t2: Answer to new request delay  */
+        platformDelayUs(RFAL_ST25TB_T2);  /* Wait t2: Answer to new request delay  */
         
         if( i==0U )
         {
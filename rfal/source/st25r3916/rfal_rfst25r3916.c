@@ -71,6 +71,22 @@
     #define RFAL_FEATURE_LOWPOWER_MODE  false   /* Low Power mode configuration missing. Disabled by default */
 #endif /* RFAL_FEATURE_LOWPOWER_MODE */
 
+#ifndef RFAL_FEATURE_TX_PRESTAGE
+    #define RFAL_FEATURE_TX_PRESTAGE    false   /* Tx pre-staging configuration missing. Disabled by default */
+#endif /* RFAL_FEATURE_TX_PRESTAGE */
+
+#ifndef RFAL_FEATURE_HW_TIMERS
+    #define RFAL_FEATURE_HW_TIMERS      false   /* HW timers configuration missing. Disabled by default */
+#endif /* RFAL_FEATURE_HW_TIMERS */
+
+#ifndef RFAL_FEATURE_PROFILER
+    #define RFAL_FEATURE_PROFILER       false   /* Transceive profiler configuration missing. Disabled by default */
+#endif /* RFAL_FEATURE_PROFILER */
+
+#ifndef RFAL_PROF_MAX_STATS
+    #define RFAL_PROF_MAX_STATS         8U      /* Number of mode and bit rates combinations timed by the profiler */
+#endif /* RFAL_PROF_MAX_STATS */
+
 
 /*
 ******************************************************************************
@@ -83,6 +99,8 @@ typedef struct{
     rfalTransceiveState     state;       /*!< Current transceive state                            */
     rfalTransceiveState     lastState;   /*!< Last transceive state (debug purposes)              */
     ReturnCode              status;      /*!< Current status/error of the transceive              */
+    bool                    staged;      /*!< Transmit sequence recorded while waiting GT/FDT     */
+    bool                    stageTried;  /*!< Recording already attempted on this transceive       */
     
     rfalTransceiveContext   ctx;         /*!< The transceive context given by the caller          */
 } rfalTxRx;
@@ -116,6 +134,21 @@ typedef struct{
 } rfalLpm;
 
 
+#if RFAL_FEATURE_PROFILER
+/*! Struct that holds the transceive latency profiler                                                */
+typedef struct{
+    bool                    active;                   /*!< A transceive is being timed              */
+    rfalProfPhase           phase;                    /*!< Phase being timed                        */
+    uint8_t                 visited;                  /*!< Phases gone through, bit per phase       */
+    uint64_t                start;                    /*!< Start of the transceive (ns)             */
+    uint64_t                phaseStart;               /*!< Start of the current phase (ns)          */
+    uint64_t                phaseNs[RFAL_PROF_PHASE_TOTAL]; /*!< Time spent on each phase (ns)      */
+    uint8_t                 statsCnt;                 /*!< Number of entries in use on stats        */
+    rfalProfStats           stats[RFAL_PROF_MAX_STATS];/*!< Latencies per mode and bit rates        */
+} rfalProf;
+#endif /* RFAL_FEATURE_PROFILER */
+
+
 /*! Struct that holds the timings GT and FDTs                           */
 typedef struct{
     uint32_t                GT;          /*!< GT in 1/fc                */
@@ -130,9 +163,19 @@ typedef struct{
     uint32_t                GT;          /*!< RFAL's GT timer           */
     uint32_t                RXE;         /*!< Timer between RXS and RXE */
     uint32_t                txRx;        /*!< Transceive sanity timer   */
+    bool                    GTonGPT;     /*!< GT is timed by the GPT    */
 } rfalTimers;
 
 
+/*! Struct that holds the mode and bit rates applied on the ST25R3916   */
+typedef struct{
+    rfalMode                mode;        /*!< Mode applied, RFAL_MODE_NONE if unknown       */
+    rfalBitRate             txBR;        /*!< Tx Bit Rate applied, RFAL_BR_KEEP if unknown  */
+    rfalBitRate             rxBR;        /*!< Rx Bit Rate applied, RFAL_BR_KEEP if unknown  */
+    uint16_t                acGen;       /*!< Analog Config generation of the mode settings */
+} rfalApplied;
+
+
 /*! Struct that holds the RFAL's callbacks                              */
 typedef struct{
     rfalPreTxRxCallback     preTxRx;     /*!< RFAL's Pre TxRx callback  */
@@ -146,6 +189,8 @@ typedef struct{
     uint16_t                bytesTotal;  /*!< Total bytes to be transmitted OR the total bytes received                                  */
     uint16_t                bytesWritten;/*!< Amount of bytes already written on FIFO (Tx) OR read (RX) from FIFO and written on rxBuffer*/
     uint8_t                 status[ST25R3916_FIFO_STATUS_LEN];   /*!< FIFO Status Registers                                              */
+    bool                    adaptive;    /*!< Current Tx or Rx uses the adaptive water level strategy                                    */
+    rfalFifoMargins         margins;     /*!< FIFO margins observed on the water level interrupts                                        */
 } rfalFIFO;
 
 
@@ -154,6 +199,7 @@ typedef struct{
     uint8_t                 obsvModeTx;  /*!< RFAL's config of the ST25R3916's observation mode while Tx */
     uint8_t                 obsvModeRx;  /*!< RFAL's config of the ST25R3916's observation mode while Rx */
     rfalEHandling           eHandling;   /*!< RFAL's error handling config/mode                          */
+    rfalFifoWLConfig        fifoWL;      /*!< RFAL's FIFO water level strategy                           */
 } rfalConfigs;
 
 
@@ -188,6 +234,7 @@ typedef struct{
     rfalBitRate             txBR;      /*!< RFAL's current Tx Bit Rate                    */
     rfalBitRate             rxBR;      /*!< RFAL's current Rx Bit Rate                    */
     bool                    field;     /*!< Current field state (On / Off)                */
+    rfalApplied             applied;   /*!< Mode and bit rates applied on the ST25R3916   */
                             
     rfalConfigs             conf;      /*!< RFAL's configuration settings                 */
     rfalTimings             timings;   /*!< RFAL's timing setting                         */
@@ -208,6 +255,10 @@ typedef struct{
 #if RFAL_FEATURE_LOWPOWER_MODE
     rfalLpm                 lpm;       /*!< RFAL's Low power mode management              */
 #endif /* RFAL_FEATURE_LOWPOWER_MODE */
+
+#if RFAL_FEATURE_PROFILER
+    rfalProf                prof;      /*!< RFAL's transceive latency profiler            */
+#endif /* RFAL_FEATURE_PROFILER */
     
 #if RFAL_FEATURE_NFCF
     rfalNfcfWorkingData     nfcfData;  /*!< RFAL's working data when supporting NFC-F     */
@@ -254,6 +305,16 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Both members are of the same type
 #define RFAL_FIFO_IN_WL                 200U                                          /*!< Number of bytes in the FIFO when WL interrupt occurs while Tx                   */
 #define RFAL_FIFO_OUT_WL                (ST25R3916_FIFO_DEPTH - RFAL_FIFO_IN_WL)      /*!< Number of bytes sent/out of the FIFO when WL interrupt occurs while Tx          */
 
+#ifndef RFAL_FIFO_WL_STRATEGY
+#define RFAL_FIFO_WL_STRATEGY           RFAL_FIFO_WL_ADAPTIVE                         /*!< Default FIFO water level strategy                                               */
+#endif
+#ifndef RFAL_FIFO_WL_MIN_BR
+#define RFAL_FIFO_WL_MIN_BR             RFAL_BR_424                                   /*!< Default lowest bit rate on which the FIFO water level strategy is used          */
+#endif
+#ifndef RFAL_FIFO_WL_MIN_LEN
+#define RFAL_FIFO_WL_MIN_LEN            ST25R3916_FIFO_DEPTH                          /*!< Default shortest frame on which the FIFO water level strategy is used           */
+#endif
+
 #define RFAL_FIFO_STATUS_REG1           0U                                            /*!< Location of FIFO status register 1 in local copy                                */
 #define RFAL_FIFO_STATUS_REG2           1U                                            /*!< Location of FIFO status register 2 in local copy                                */
 #define RFAL_FIFO_STATUS_INVALID        0xFFU                                         /*!< Value indicating that the local FIFO status in invalid|cleared                  */
@@ -382,12 +443,25 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Both members are of the same type
 
 #define rfalGennTRFW( n )                        (((n)+1U)&ST25R3916_REG_AUX_nfc_n_mask)                           /*!< Generates the next n*TRRW used for RFCA       */
 
+#define rfalModeIsApplied( md )                  ( ((md) != RFAL_MODE_NONE) && ((md) == gRFAL.applied.mode) && (gRFAL.applied.acGen == rfalAnalogConfigGetGeneration()) ) /*!< Checks if the mode settings are in place on ST25R3916 */
+#define rfalBitRateIsApplied( tx, rx )           ( rfalModeIsApplied( gRFAL.mode ) && ((tx) == gRFAL.applied.txBR) && ((rx) == gRFAL.applied.rxBR) ) /*!< Checks if the bit rate settings are in place on ST25R3916 */
+
 #define rfalCalcNumBytes( nBits )                (((uint32_t)(nBits) + 7U) / 8U)                                   /*!< Returns the number of bytes required to fit given the number of bits */
 
 #define rfalTimerStart( timer, time_ms )         do{ platformTimerDestroy( timer ); (timer) = platformTimerCreate((uint16_t)(time_ms)); } while(0) /*!< Configures and starts timer         */
 #define rfalTimerisExpired( timer )              platformTimerIsExpired( timer )                                    /*!< Checks if timer has expired                                         */
 #define rfalTimerDestroy( timer )                platformTimerDestroy( timer )                                      /*!< Destroys timer                                                      */
 
+#if RFAL_FEATURE_PROFILER
+    #define rfalProfBegin()                      rfalProfStart()                                                    /*!< Starts timing a transceive                                          */
+    #define rfalProfMark( ph )                   rfalProfEnter( (ph) )                                              /*!< Times the transceive phase entered                                  */
+    #define rfalProfEnd()                        rfalProfDone()                                                     /*!< Records the transceive latencies once done                          */
+#else
+    #define rfalProfBegin()                                                                                         /*!< Profiler disabled                                                   */
+    #define rfalProfMark( ph )                                                                                      /*!< Profiler disabled                                                   */
+    #define rfalProfEnd()                                                                                           /*!< Profiler disabled                                                   */
+#endif /* RFAL_FEATURE_PROFILER */
+
 #define rfalST25R3916ObsModeDisable()            st25r3916WriteTestRegister(0x01U, (0x40U))                        /*!< Disable ST25R3916 Observation mode                                   */
 #define rfalST25R3916ObsModeTx()                 st25r3916WriteTestRegister(0x01U, (0x40U|gRFAL.conf.obsvModeTx))  /*!< Enable Tx Observation mode                                           */
 #define rfalST25R3916ObsModeRx()                 st25r3916WriteTestRegister(0x01U, (0x40U|gRFAL.conf.obsvModeRx))  /*!< Enable Rx Observation mode                                           */
@@ -412,7 +486,8 @@ typedef union{  /*  PRQA S 0750 # MISRA 19.2 - Both members are of the same type
  ******************************************************************************
  */
 
-static rfal gRFAL;              /*!< RFAL module instance               */
+static rfal gRFALInst[ST25R_MAX_INSTANCES];             /*!< RFAL module instances, one per ST25R3916  */
+#define gRFAL    (gRFALInst[platformGetInstance()])      /*!< RFAL module instance of the caller        */
 
 /*
 ******************************************************************************
@@ -423,11 +498,26 @@ static rfal gRFAL;              /*!< RFAL module instance               */
 static void rfalTransceiveTx( void );
 static void rfalTransceiveRx( void );
 static ReturnCode rfalTransceiveRunBlockingTx( void );
+static ReturnCode rfalTransceiveBlockingStep( bool inTx );
+#if defined(platformIrqEventWait) && defined(platformTimerGetDeadline)
+static void rfalTransceiveBlockingWait( uint32_t irqSeq );
+#endif /* platformIrqEventWait && platformTimerGetDeadline */
 static void rfalPrepareTransceive( void );
+static void rfalPrepareTransceiveChip( void );
+static void rfalPrepareTransceiveIrqs( void );
+static ReturnCode rfalTransceiveLoadTx( void );
+#if RFAL_FEATURE_TX_PRESTAGE
+static void rfalTransceiveStageTx( void );
+#endif /* RFAL_FEATURE_TX_PRESTAGE */
+static void rfalTransceiveStageDiscard( void );
 static void rfalCleanupTransceive( void );
 static void rfalErrorHandling( void );
+#if RFAL_FEATURE_HW_TIMERS
+static void rfalGTStopGPT( void );
+#endif /* RFAL_FEATURE_HW_TIMERS */
 
 static ReturnCode rfalRunTransceiveWorker( void );
+static void rfalRunTransceiveCallback( void );
 #if RFAL_FEATURE_LISTEN_MODE
 static ReturnCode rfalRunListenModeWorker( void );
 #endif /* RFAL_FEATURE_LISTEN_MODE */
@@ -442,6 +532,15 @@ static bool rfalFIFOStatusIsMissingPar( void );
 static bool rfalFIFOStatusIsIncompleteByte( void );
 static uint16_t rfalFIFOStatusGetNumBytes( void );
 static uint8_t  rfalFIFOGetNumIncompleteBits( void );
+static bool rfalFIFOIsAdaptive( rfalBitRate br, uint16_t len );
+static void rfalFIFOMarginsUpdate( bool isTx, uint16_t level );
+static void rfalFIFOMarginsClear( void );
+#if RFAL_FEATURE_PROFILER
+static void rfalProfStart( void );
+static void rfalProfEnter( rfalProfPhase phase );
+static void rfalProfDone( void );
+static void rfalProfRecord( rfalProfPhaseStats *st, uint64_t ns );
+#endif /* RFAL_FEATURE_PROFILER */
 
 
 /*
@@ -481,14 +580,22 @@ ReturnCode rfalInitialize( void )
     gRFAL.mode               = RFAL_MODE_NONE;
     gRFAL.field              = false;
     
+    /* Chip has been reset, no mode nor bit rate settings in place */
+    rfalInvalidateMode();
+    
     /* Set RFAL default configs */
     gRFAL.conf.obsvModeRx    = RFAL_OBSMODE_DISABLE;
     gRFAL.conf.obsvModeTx    = RFAL_OBSMODE_DISABLE;
     gRFAL.conf.eHandling     = RFAL_ERRORHANDLING_NONE;
+    gRFAL.conf.fifoWL.strategy = RFAL_FIFO_WL_STRATEGY;
+    gRFAL.conf.fifoWL.minBR    = RFAL_FIFO_WL_MIN_BR;
+    gRFAL.conf.fifoWL.minLen   = RFAL_FIFO_WL_MIN_LEN;
+    rfalFIFOMarginsClear();
     
     /* Transceive set to IDLE */
     gRFAL.TxRx.lastState     = RFAL_TXRX_STATE_IDLE;
     gRFAL.TxRx.state         = RFAL_TXRX_STATE_IDLE;
+    rfalTransceiveStageDiscard();
     
     /* Disable all timings */
     gRFAL.timings.FDTListen  = RFAL_TIMING_NONE;
@@ -503,6 +610,7 @@ ReturnCode rfalInitialize( void )
     gRFAL.tmr.GT             = RFAL_TIMING_NONE;
     gRFAL.tmr.txRx           = RFAL_TIMING_NONE;
     gRFAL.tmr.RXE            = RFAL_TIMING_NONE;
+    gRFAL.tmr.GTonGPT        = false;
     
     gRFAL.callbacks.preTxRx  = NULL;
     gRFAL.callbacks.postTxRx = NULL;
@@ -529,6 +637,12 @@ ReturnCode rfalInitialize( void )
     /* Initialize Low Power Mode */
     gRFAL.lpm.isRunning     = false;
 #endif /* RFAL_FEATURE_LOWPOWER_MODE */
+
+#if RFAL_FEATURE_PROFILER
+    /* Initialize the transceive profiler */
+    gRFAL.prof.active       = false;
+    rfalClearProfStats();
+#endif /* RFAL_FEATURE_PROFILER */
     
     
     /*******************************************************************************/    
@@ -604,6 +718,7 @@ ReturnCode rfalDeinitialize( void )
     /* Set Analog configurations for deinitialization */
     rfalSetAnalogConfig( (RFAL_ANALOG_CONFIG_TECH_CHIP | RFAL_ANALOG_CONFIG_CHIP_DEINIT) );
  
+    rfalInvalidateMode();
     gRFAL.state = RFAL_STATE_IDLE;
     return ERR_NONE;
 }
@@ -641,9 +756,80 @@ void rfalDisableObsvMode( void )
 
 
 /*******************************************************************************/
-ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
+ReturnCode rfalSetFifoWLConfig( const rfalFifoWLConfig *config )
 {
+    if( config == NULL )
+    {
+        return ERR_PARAM;
+    }
+    
+    if( (config->strategy > RFAL_FIFO_WL_ADAPTIVE) || (config->minBR > RFAL_BR_13560) )
+    {
+        return ERR_PARAM;
+    }
+    
+    gRFAL.conf.fifoWL = *config;
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void rfalGetFifoWLConfig( rfalFifoWLConfig *config )
+{
+    if( config != NULL )
+    {
+        *config = gRFAL.conf.fifoWL;
+    }
+}
+
+
+/*******************************************************************************/
+void rfalGetFifoMargins( rfalFifoMargins *margins, bool clear )
+{
+    if( margins != NULL )
+    {
+        *margins = gRFAL.fifo.margins;
+    }
+    
+    if( clear )
+    {
+        rfalFIFOMarginsClear();
+    }
+}
+
+
+#if RFAL_FEATURE_PROFILER
+/*******************************************************************************/
+uint8_t rfalGetProfStats( rfalProfStats *stats, uint8_t statsLen )
+{
+    uint8_t cnt;
+    
+    if( stats == NULL )
+    {
+        return 0U;
+    }
+    
+    cnt = MIN( statsLen, gRFAL.prof.statsCnt );
+    ST_MEMCPY( stats, gRFAL.prof.stats, ((uint32_t)cnt * sizeof(rfalProfStats)) );
+    
+    return cnt;
+}
+
 
+/*******************************************************************************/
+void rfalClearProfStats( void )
+{
+    gRFAL.prof.statsCnt = 0U;
+    ST_MEMSET( gRFAL.prof.stats, 0x00, sizeof(gRFAL.prof.stats) );
+}
+#endif /* RFAL_FEATURE_PROFILER */
+
+
+/*******************************************************************************/
+ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
+{
+    uint16_t acGen;
+    
     /* Check if RFAL is not initialized */
     if( gRFAL.state == RFAL_STATE_IDLE )
     {
@@ -655,6 +841,22 @@ ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
     {
         return ERR_PARAM;
     }
+    
+    /* Mode settings still in place, only the bit rates may need to be applied.                   *
+     * Active comms also arm the GPT, NRT, PPon2 and GT timers, which are used and changed outside *
+     * the mode settings (e.g. GT, FDT Poll), so they are always fully applied                     */
+    if( rfalModeIsApplied( mode ) && !rfalIsModeActiveComm( mode ) )
+    {
+        gRFAL.state = ((gRFAL.state < RFAL_STATE_MODE_SET) ? RFAL_STATE_MODE_SET : gRFAL.state);
+        gRFAL.mode  = mode;
+        
+        return rfalSetBitRate(txBR, rxBR);
+    }
+    
+    /* Mode settings are unknown until fully applied. A setting failing *
+     * to apply moves the generation on, leaving the mode not applied   */
+    rfalInvalidateMode();
+    acGen = rfalAnalogConfigGetGeneration();
    
     switch( mode )
     {
@@ -884,11 +1086,24 @@ ReturnCode rfalSetMode( rfalMode mode, rfalBitRate txBR, rfalBitRate rxBR )
     gRFAL.state = ((gRFAL.state < RFAL_STATE_MODE_SET) ? RFAL_STATE_MODE_SET : gRFAL.state);
     gRFAL.mode  = mode;
     
+    /* Mode settings are in place, bit rate settings are applied next */
+    gRFAL.applied.mode  = mode;
+    gRFAL.applied.acGen = acGen;
+    
     /* Apply the given bit rate */
     return rfalSetBitRate(txBR, rxBR);
 }
 
 
+/*******************************************************************************/
+void rfalInvalidateMode( void )
+{
+    gRFAL.applied.mode = RFAL_MODE_NONE;
+    gRFAL.applied.txBR = RFAL_BR_KEEP;
+    gRFAL.applied.rxBR = RFAL_BR_KEEP;
+}
+
+
 /*******************************************************************************/
 rfalMode rfalGetMode( void )
 {
@@ -911,6 +1126,16 @@ ReturnCode rfalSetBitRate( rfalBitRate txBR, rfalBitRate rxBR )
     gRFAL.txBR = ((txBR == RFAL_BR_KEEP) ? gRFAL.txBR : txBR);
     gRFAL.rxBR = ((rxBR == RFAL_BR_KEEP) ? gRFAL.rxBR : rxBR);
     
+    /* Bit rate settings still in place, nothing to apply */
+    if( rfalBitRateIsApplied( gRFAL.txBR, gRFAL.rxBR ) )
+    {
+        return ERR_NONE;
+    }
+    
+    /* Bit rate settings are unknown until fully applied */
+    gRFAL.applied.txBR = RFAL_BR_KEEP;
+    gRFAL.applied.rxBR = RFAL_BR_KEEP;
+    
     /* Update the bitrate reg if not in NFCV mode (streaming) */
     if( (RFAL_MODE_POLL_NFCV != gRFAL.mode) && (RFAL_MODE_POLL_PICOPASS != gRFAL.mode) )
     {
@@ -1045,6 +1270,9 @@ ReturnCode rfalSetBitRate( rfalBitRate txBR, rfalBitRate rxBR )
             return ERR_NOT_IMPLEMENTED;
     }
     
+    gRFAL.applied.txBR = gRFAL.txBR;
+    gRFAL.applied.rxBR = gRFAL.rxBR;
+    
     return ERR_NONE;
 }
 
@@ -1152,6 +1380,23 @@ bool rfalIsGTExpired( void )
 {
     if( gRFAL.tmr.GT != RFAL_TIMING_NONE )
     {
+    #if RFAL_FEATURE_HW_TIMERS
+        if( gRFAL.tmr.GTonGPT )
+        {
+            /* GT ends on GPE, the SW timer only bounds the wait if the GPT got stopped meanwhile */
+            if( (st25r3916GetInterrupt( ST25R3916_IRQ_MASK_GPE ) == 0U) && !rfalTimerisExpired( gRFAL.tmr.GT ) )
+            {
+                return false;
+            }
+            
+            rfalGTStopGPT();
+            
+            rfalTimerDestroy( gRFAL.tmr.GT );
+            gRFAL.tmr.GT = RFAL_TIMING_NONE;
+            return true;
+        }
+    #endif /* RFAL_FEATURE_HW_TIMERS */
+        
         if( !rfalTimerisExpired( gRFAL.tmr.GT ) )
         {
             return false;
@@ -1161,10 +1406,28 @@ bool rfalIsGTExpired( void )
 }
 
 
+#if RFAL_FEATURE_HW_TIMERS
+/*******************************************************************************/
+static void rfalGTStopGPT( void )
+{
+    /* Stop waiting the GPE of a GT timed by the GPT */
+    if( gRFAL.tmr.GTonGPT )
+    {
+        st25r3916DisableInterrupts( ST25R3916_IRQ_MASK_GPE );
+        gRFAL.tmr.GTonGPT = false;
+    }
+}
+#endif /* RFAL_FEATURE_HW_TIMERS */
+
+
 /*******************************************************************************/
 ReturnCode rfalFieldOnAndStartGT( void )
 {
     ReturnCode ret;
+    uint32_t   gt;
+#if RFAL_FEATURE_HW_TIMERS
+    bool       gptFree;
+#endif /* RFAL_FEATURE_HW_TIMERS */
     
     /* Check if RFAL has been initialized (Oscillator should be running) and also
      * if a direct register access has been performed and left the Oscillator Off */
@@ -1205,8 +1468,29 @@ ReturnCode rfalFieldOnAndStartGT( void )
     /* Start GT timer in case the GT value is set */
     if( (gRFAL.timings.GT != RFAL_TIMING_NONE) )
     {
-        /* Ensure that a SW timer doesn't have a lower value then the minimum  */
-        rfalTimerStart( gRFAL.tmr.GT, rfalConv1fcToMs( MAX( (gRFAL.timings.GT), RFAL_ST25R3916_GT_MIN_1FC) ) );
+        /* Ensure that GT doesn't have a lower value then the minimum */
+        gt = MAX( (gRFAL.timings.GT), RFAL_ST25R3916_GT_MIN_1FC );
+        
+    #if RFAL_FEATURE_HW_TIMERS
+        /* A GT within the GPT range is timed by the GPT, unless it is still measuring a FDT Poll *
+         * or, in Active comms, armed by rfalSetMode() as field Off timer on its own trigger.     *
+         * A previous GT still on the GPT is restarted. GPE signals its end, the SW timer rounded *
+         * up to the next ms is only kept as backstop                                             */
+        gptFree = ( gRFAL.tmr.GTonGPT || !st25r3916IsGPTRunning() );
+        rfalGTStopGPT();
+        
+        gRFAL.tmr.GTonGPT = ( (gt <= RFAL_ST25R3916_GPT_MAX_1FC) && gptFree && !rfalIsModeActiveComm( gRFAL.mode ) );
+        if( gRFAL.tmr.GTonGPT )
+        {
+            st25r3916ClearAndEnableInterrupts( ST25R3916_IRQ_MASK_GPE );
+            st25r3916SetStartGPTimer( (uint16_t)rfalConv1fcTo8fc( (gt + RFAL_1FC_IN_8FC) - 1U ), ST25R3916_REG_TIMER_EMV_CONTROL_gptc_no_trigger );
+            rfalTimerStart( gRFAL.tmr.GT, (rfalConv1fcToMs( gt ) + RFAL_ST25R3916_SW_TMR_MIN_1MS) );
+        }
+        else
+    #endif /* RFAL_FEATURE_HW_TIMERS */
+        {
+            rfalTimerStart( gRFAL.tmr.GT, rfalConv1fcToMs( gt ) );
+        }
     }
     
     return ret;
@@ -1220,11 +1504,17 @@ ReturnCode rfalFieldOff( void )
     if( gRFAL.TxRx.state != RFAL_TXRX_STATE_IDLE )
     {
         rfalCleanupTransceive();
+        gRFAL.TxRx.ctx.callback = NULL;   /* Aborted, completion is not signaled */
     }
     
     /* Disable Tx and Rx */
     st25r3916TxRxOff();
     
+#if RFAL_FEATURE_HW_TIMERS
+    /* A GT on the GPT no longer applies, the SW timer is left to expire */
+    rfalGTStopGPT();
+#endif /* RFAL_FEATURE_HW_TIMERS */
+    
     /* Set Analog configurations for Field Off event */
     rfalSetAnalogConfig( (RFAL_ANALOG_CONFIG_TECH_CHIP | RFAL_ANALOG_CONFIG_CHIP_FIELD_OFF) );
     gRFAL.field = false;
@@ -1254,6 +1544,9 @@ ReturnCode rfalStartTransceive( const rfalTransceiveContext *ctx )
             return ERR_WRONG_STATE;
         }
         
+        /* Drop a transmit sequence staged for a transceive that never got to transmit */
+        rfalTransceiveStageDiscard();
+        
         gRFAL.TxRx.ctx = *ctx;
         
         /*******************************************************************************/
@@ -1320,6 +1613,8 @@ ReturnCode rfalStartTransceive( const rfalTransceiveContext *ctx )
         gRFAL.state       = RFAL_STATE_TXRX;
         gRFAL.TxRx.state  = RFAL_TXRX_STATE_TX_IDLE;
         gRFAL.TxRx.status = ERR_BUSY;
+        gRFAL.TxRx.stageTried = false;
+        rfalProfBegin();
         
         
     #if RFAL_FEATURE_NFCV
@@ -1405,14 +1700,84 @@ ReturnCode rfalTransceiveBlockingTx( uint8_t* txBuf, uint16_t txBufLen, uint8_t*
 }
 
 
+#if defined(platformIrqEventWait) && defined(platformTimerGetDeadline)
+/*******************************************************************************/
+static void rfalTransceiveBlockingWait( uint32_t irqSeq )
+{
+    uint64_t deadline;
+    uint64_t tmrDeadline;
+    
+    /* Only states waiting for an interrupt or a SW timer can sleep, others keep on running */
+    switch( gRFAL.TxRx.state )
+    {
+        case RFAL_TXRX_STATE_TX_WAIT_GT:
+            tmrDeadline = platformTimerGetDeadline( gRFAL.tmr.GT );
+            break;
+            
+        case RFAL_TXRX_STATE_RX_WAIT_RXE:
+            tmrDeadline = platformTimerGetDeadline( gRFAL.tmr.RXE );
+            break;
+            
+        case RFAL_TXRX_STATE_TX_WAIT_WL:
+        case RFAL_TXRX_STATE_TX_WAIT_TXE:
+        case RFAL_TXRX_STATE_RX_WAIT_RXS:
+        case RFAL_TXRX_STATE_RX_WAIT_EON:
+        case RFAL_TXRX_STATE_RX_WAIT_EOF:
+            tmrDeadline = 0U;
+            break;
+            
+        default:
+            return;   /* Next step depends on a polled chip timer (FDT) or on nothing at all */
+    }
+    
+    /* The Transceive Sanity Timer bounds any wait */
+    deadline = platformTimerGetDeadline( gRFAL.tmr.txRx );
+    if( (tmrDeadline != 0U) && ((deadline == 0U) || (tmrDeadline < deadline)) )
+    {
+        deadline = tmrDeadline;
+    }
+    
+    /* Park until an interrupt has been serviced since irqSeq or the nearest deadline */
+    platformIrqEventWait( irqSeq, deadline );
+}
+#endif /* platformIrqEventWait && platformTimerGetDeadline */
+
+
+/*******************************************************************************/
+static ReturnCode rfalTransceiveBlockingStep( bool inTx )
+{
+    ReturnCode ret;
+#if defined(platformIrqEventWait) && defined(platformTimerGetDeadline)
+    uint32_t   irqSeq;
+    
+    /* Sample before running the worker so that no interrupt is missed */
+    irqSeq = platformIrqEventGet();
+#endif /* platformIrqEventWait && platformTimerGetDeadline */
+    
+    rfalWorker();
+    ret = rfalGetTransceiveStatus();
+    
+#if defined(platformIrqEventWait) && defined(platformTimerGetDeadline)
+    /* Park only if the blocking loop is to step again in the same phase */
+    if( (ret == ERR_BUSY) && (inTx ? rfalIsTransceiveInTx() : rfalIsTransceiveInRx()) )
+    {
+        rfalTransceiveBlockingWait( irqSeq );
+    }
+#else
+    NO_WARNING(inTx);
+#endif /* platformIrqEventWait && platformTimerGetDeadline */
+    
+    return ret;
+}
+
+
 /*******************************************************************************/
 static ReturnCode rfalTransceiveRunBlockingTx( void )
 {
     ReturnCode ret;
         
     do{
-        rfalWorker();
-        ret = rfalGetTransceiveStatus();
+        ret = rfalTransceiveBlockingStep( true );
     }
     while( rfalIsTransceiveInTx() && (ret == ERR_BUSY) );
     
@@ -1431,8 +1796,7 @@ ReturnCode rfalTransceiveBlockingRx( void )
     ReturnCode ret;
     
     do{
-        rfalWorker();
-        ret = rfalGetTransceiveStatus();
+        ret = rfalTransceiveBlockingStep( false );
     }
     while( rfalIsTransceiveInRx() && (ret == ERR_BUSY) );    
         
@@ -1480,11 +1844,13 @@ static ReturnCode rfalRunTransceiveWorker( void )
         if( rfalIsTransceiveInTx() )
         {
             rfalTransceiveTx();
+            rfalProfEnd();
             return rfalGetTransceiveStatus();
         }
         if( rfalIsTransceiveInRx() )
         {
             rfalTransceiveRx();
+            rfalProfEnd();
             return rfalGetTransceiveStatus();
         }
     }    
@@ -1492,6 +1858,22 @@ static ReturnCode rfalRunTransceiveWorker( void )
 }
 
 
+/*******************************************************************************/
+static void rfalRunTransceiveCallback( void )
+{
+    rfalTransceiveCallback cb;
+    
+    if( (gRFAL.TxRx.ctx.callback != NULL) && (gRFAL.TxRx.state == RFAL_TXRX_STATE_IDLE) )
+    {
+        /* Callback is consumed before being called as it may start the next Transceive */
+        cb = gRFAL.TxRx.ctx.callback;
+        gRFAL.TxRx.ctx.callback = NULL;
+        
+        cb( gRFAL.TxRx.ctx.userParam, gRFAL.TxRx.status );
+    }
+}
+
+
 /*******************************************************************************/
 rfalTransceiveState rfalGetTransceiveState( void )
 {
@@ -1572,6 +1954,8 @@ void rfalWorker( void )
     }
     
     platformUnprotectWorker();             /* Unprotect RFAL Worker/Task/Process */
+    
+    rfalRunTransceiveCallback();           /* Signal Transceive completion, if requested */
 }
 
 
@@ -1675,6 +2059,9 @@ static void rfalErrorHandling( void )
 /*******************************************************************************/
 static void rfalCleanupTransceive( void )
 {
+    /* A transmit sequence still staged was never sent */
+    rfalTransceiveStageDiscard();
+    
     /*******************************************************************************/
     /* Transceive flags                                                            */
     /*******************************************************************************/
@@ -1713,7 +2100,14 @@ static void rfalCleanupTransceive( void )
 /*******************************************************************************/
 static void rfalPrepareTransceive( void )
 {
-    uint32_t maskInterrupts;
+    rfalPrepareTransceiveChip();
+    rfalPrepareTransceiveIrqs();
+}
+
+
+/*******************************************************************************/
+static void rfalPrepareTransceiveChip( void )
+{
     uint8_t  reg;
     
     /* If we are in RW or AP2P mode */
@@ -1755,12 +2149,6 @@ static void rfalPrepareTransceive( void )
     /*******************************************************************************/
     
     
-    maskInterrupts = ( ST25R3916_IRQ_MASK_FWL  | ST25R3916_IRQ_MASK_TXE  |
-                       ST25R3916_IRQ_MASK_RXS  | ST25R3916_IRQ_MASK_RXE  |
-                       ST25R3916_IRQ_MASK_PAR  | ST25R3916_IRQ_MASK_CRC  |
-                       ST25R3916_IRQ_MASK_ERR1 | ST25R3916_IRQ_MASK_ERR2 |
-                       ST25R3916_IRQ_MASK_NRE                               );
-    
     /*******************************************************************************/
     /* Transceive flags                                                            */
     /*******************************************************************************/
@@ -1807,7 +2195,6 @@ static void rfalPrepareTransceive( void )
     if( gRFAL.conf.eHandling == RFAL_ERRORHANDLING_EMVCO )
     {
         st25r3916SetRegisterBits( ST25R3916_REG_TIMER_EMV_CONTROL, ST25R3916_REG_TIMER_EMV_CONTROL_nrt_emv );
-        maskInterrupts |= ST25R3916_IRQ_MASK_RX_REST;
     }
     else
     {
@@ -1815,19 +2202,42 @@ static void rfalPrepareTransceive( void )
     }
     /*******************************************************************************/
     
+    /* In Active comms set RF Collsion Avoindance */
+    if( rfalIsModeActiveComm( gRFAL.mode ) )
+    {
+        /* Set n=0 for subsequent RF Collision Avoidance */
+        st25r3916ChangeRegisterBits(ST25R3916_REG_AUX, ST25R3916_REG_AUX_nfc_n_mask, 0);
+    }
+}
+
+
+/*******************************************************************************/
+static void rfalPrepareTransceiveIrqs( void )
+{
+    uint32_t maskInterrupts;
+    
+    maskInterrupts = ( ST25R3916_IRQ_MASK_FWL  | ST25R3916_IRQ_MASK_TXE  |
+                       ST25R3916_IRQ_MASK_RXS  | ST25R3916_IRQ_MASK_RXE  |
+                       ST25R3916_IRQ_MASK_PAR  | ST25R3916_IRQ_MASK_CRC  |
+                       ST25R3916_IRQ_MASK_ERR1 | ST25R3916_IRQ_MASK_ERR2 |
+                       ST25R3916_IRQ_MASK_NRE                               );
+    
+    /* EMVCo NRT mode */
+    if( gRFAL.conf.eHandling == RFAL_ERRORHANDLING_EMVCO )
+    {
+        maskInterrupts |= ST25R3916_IRQ_MASK_RX_REST;
+    }
+    
     /* In Passive Listen mode additionally enable External Field interrupts  */    
     if( rfalIsModePassiveListen( gRFAL.mode ) )
     {
         maskInterrupts |= ( ST25R3916_IRQ_MASK_EOF | ST25R3916_IRQ_MASK_WU_F );      /* Enable external Field interrupts to detect Link Loss and SENF_REQ auto responses */
     }
     
-    /* In Active comms enable also External Field interrupts and set RF Collsion Avoindance */
+    /* In Active comms enable also External Field interrupts */
     if( rfalIsModeActiveComm( gRFAL.mode ) )
     {
         maskInterrupts |= ( ST25R3916_IRQ_MASK_EOF  | ST25R3916_IRQ_MASK_EON  | ST25R3916_IRQ_MASK_PPON2 | ST25R3916_IRQ_MASK_CAT | ST25R3916_IRQ_MASK_CAC );
-        
-        /* Set n=0 for subsequent RF Collision Avoidance */
-        st25r3916ChangeRegisterBits(ST25R3916_REG_AUX, ST25R3916_REG_AUX_nfc_n_mask, 0);
     }
     
     /*******************************************************************************/
@@ -1849,11 +2259,144 @@ static void rfalPrepareTransceive( void )
 }
 
 
+/*******************************************************************************/
+static ReturnCode rfalTransceiveLoadTx( void )
+{
+    ReturnCode ret;
+    
+    /* Supress warning in case NFC-V feature is disabled */
+    ret = ERR_NONE;
+    NO_WARNING( ret );
+    
+    /* ST25R3916 has a fixed FIFO water level */
+    gRFAL.fifo.expWL    = RFAL_FIFO_OUT_WL;
+    gRFAL.fifo.adaptive = false;
+
+#if RFAL_FEATURE_NFCV
+    /*******************************************************************************/
+    /* In NFC-V streaming mode, the FIFO needs to be loaded with the coded bits    */
+    if( (RFAL_MODE_POLL_NFCV == gRFAL.mode) || (RFAL_MODE_POLL_PICOPASS == gRFAL.mode) )
+    {
+#if 0
+        /* Debugging code: output the payload bits by writing into the FIFO and subsequent clearing */
+        st25r3916WriteFifo(gRFAL.TxRx.ctx.txBuf, rfalConvBitsToBytes(gRFAL.TxRx.ctx.txBufLen));
+        st25r3916ExecuteCommand( ST25R3916_CMD_CLEAR_FIFO );
+#endif
+        /* Calculate the bytes needed to be Written into FIFO (a incomplete byte will be added as 1byte) */
+        gRFAL.nfcvData.nfcvOffset = 0;
+        ret = iso15693VCDCode(gRFAL.TxRx.ctx.txBuf, rfalConvBitsToBytes(gRFAL.TxRx.ctx.txBufLen), (((gRFAL.nfcvData.origCtx.flags & (uint32_t)RFAL_TXRX_FLAGS_CRC_TX_MANUAL) != 0U)?false:true),(((gRFAL.nfcvData.origCtx.flags & (uint32_t)RFAL_TXRX_FLAGS_NFCV_FLAG_MANUAL) != 0U)?false:true), (RFAL_MODE_POLL_PICOPASS == gRFAL.mode),
+                  &gRFAL.fifo.bytesTotal, &gRFAL.nfcvData.nfcvOffset, gRFAL.nfcvData.codingBuffer, MIN( (uint16_t)ST25R3916_FIFO_DEPTH, (uint16_t)sizeof(gRFAL.nfcvData.codingBuffer) ), &gRFAL.fifo.bytesWritten);
+
+        if( (ret != ERR_NONE) && (ret != ERR_AGAIN) )
+        {
+            return ret;
+        }
+        /* Set the number of full bytes and bits to be transmitted */
+        st25r3916SetNumTxBits( (uint16_t)rfalConvBytesToBits(gRFAL.fifo.bytesTotal) );
+
+        /* Load FIFO with coded bytes */
+        st25r3916WriteFifo( gRFAL.nfcvData.codingBuffer, gRFAL.fifo.bytesWritten );
+
+    }
+    /*******************************************************************************/
+    else
+#endif /* RFAL_FEATURE_NFCV */
+    {
+        /* Calculate the bytes needed to be Written into FIFO (a incomplete byte will be added as 1byte) */
+        gRFAL.fifo.bytesTotal = (uint16_t)rfalCalcNumBytes(gRFAL.TxRx.ctx.txBufLen);
+        gRFAL.fifo.adaptive   = rfalFIFOIsAdaptive( gRFAL.txBR, gRFAL.fifo.bytesTotal );
+        
+        /* Set the number of full bytes and bits to be transmitted */
+        st25r3916SetNumTxBits( gRFAL.TxRx.ctx.txBufLen );
+        
+        /* Load FIFO with total length or FIFO's maximum */
+        gRFAL.fifo.bytesWritten = MIN( gRFAL.fifo.bytesTotal, ST25R3916_FIFO_DEPTH );
+        st25r3916WriteFifo( gRFAL.TxRx.ctx.txBuf, gRFAL.fifo.bytesWritten );
+    }
+
+    /*Check if Observation Mode is enabled and set it on ST25R391x */
+    rfalCheckEnableObsModeTx();
+    
+    
+    /*******************************************************************************/
+    /* If we're in Passive Listen mode ensure that the external field is still On  */
+    if( rfalIsModePassiveListen(gRFAL.mode) )
+    {
+        if( !rfalIsExtFieldOn() )
+        {
+            return ERR_LINK_LOSS;
+        }
+    }
+    
+    /*******************************************************************************/
+    /* Trigger/Start transmission                                                  */
+    if( (gRFAL.TxRx.ctx.flags & (uint32_t)RFAL_TXRX_FLAGS_CRC_TX_MANUAL) != 0U )
+    {
+        st25r3916ExecuteCommand( ST25R3916_CMD_TRANSMIT_WITHOUT_CRC );
+    }
+    else
+    {
+        st25r3916ExecuteCommand( ST25R3916_CMD_TRANSMIT_WITH_CRC );
+    }
+    
+    return ERR_NONE;
+}
+
+
+#if RFAL_FEATURE_TX_PRESTAGE
+/*******************************************************************************/
+static void rfalTransceiveStageTx( void )
+{
+    ReturnCode ret;
+    
+    /* Stage once per transceive and only in Poll, where nothing else is written before the transmit */
+    if( gRFAL.TxRx.stageTried || !rfalIsModePassivePoll( gRFAL.mode ) )
+    {
+        return;
+    }
+    
+    /* A failed attempt is not repeated on every wait, the transmit state loads the FIFO itself */
+    gRFAL.TxRx.stageTried = true;
+    
+    if( st25r3916StageStart() != ERR_NONE )
+    {
+        return;
+    }
+    
+    /* Record the FIFO load and the transmit command, sent after the chip preparation once GT and FDT are over */
+    ret = rfalTransceiveLoadTx();
+    
+    if( (st25r3916StageStop() == ERR_NONE) && (ret == ERR_NONE) )
+    {
+        gRFAL.TxRx.staged = true;
+    }
+    else
+    {
+        /* Leave it to the transmit state, which reports any error */
+        st25r3916StageDiscard();
+    }
+}
+#endif /* RFAL_FEATURE_TX_PRESTAGE */
+
+
+/*******************************************************************************/
+static void rfalTransceiveStageDiscard( void )
+{
+    if( gRFAL.TxRx.staged )
+    {
+        st25r3916StageDiscard();
+        gRFAL.TxRx.staged = false;
+    }
+}
+
+
 /*******************************************************************************/
 static void rfalTransceiveTx( void )
 {
     volatile uint32_t irqs;
     uint16_t          tmp;
+    uint16_t          level;
+    bool              batch;
     ReturnCode        ret;
     
     /* Supress warning in case NFC-V feature is disabled */
@@ -1882,8 +2425,13 @@ static void rfalTransceiveTx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_TX_WAIT_GT:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_GT );
+            
             if( !rfalIsGTExpired() )
             {
+            #if RFAL_FEATURE_TX_PRESTAGE
+                rfalTransceiveStageTx();
+            #endif /* RFAL_FEATURE_TX_PRESTAGE */
                 break;
             }
             
@@ -1897,11 +2445,16 @@ static void rfalTransceiveTx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_TX_WAIT_FDT:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_FDT );
+            
             /* Only in Passive communications GPT is used to measure FDT Poll */
             if( rfalIsModePassiveComm( gRFAL.mode ) )
             {
                 if( st25r3916IsGPTRunning() )
-                {                
+                {
+                #if RFAL_FEATURE_TX_PRESTAGE
+                    rfalTransceiveStageTx();
+                #endif /* RFAL_FEATURE_TX_PRESTAGE */
                    break;
                 }
             }
@@ -1913,80 +2466,39 @@ static void rfalTransceiveTx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_TX_TRANSMIT:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
-            /* Clear FIFO, Clear and Enable the Interrupts */
-            rfalPrepareTransceive( );
-
-            /* ST25R3916 has a fixed FIFO water level */
-            gRFAL.fifo.expWL = RFAL_FIFO_OUT_WL;
-
-        #if RFAL_FEATURE_NFCV
-            /*******************************************************************************/
-            /* In NFC-V streaming mode, the FIFO needs to be loaded with the coded bits    */
-            if( (RFAL_MODE_POLL_NFCV == gRFAL.mode) || (RFAL_MODE_POLL_PICOPASS == gRFAL.mode) )
+            rfalProfMark( RFAL_PROF_PHASE_TRANSMIT );
+            
+            /* Send the whole transmit sequence on a single transfer */
+            batch = (st25r3916BatchStart() == ERR_NONE);
+            
+            if( gRFAL.TxRx.staged )
             {
-#if 0
-                /* Debugging code: output the payload bits by writing into the FIFO and subsequent clearing */
-                st25r3916WriteFifo(gRFAL.TxRx.ctx.txBuf, rfalConvBitsToBytes(gRFAL.TxRx.ctx.txBufLen));
-                st25r3916ExecuteCommand( ST25R3916_CMD_CLEAR_FIFO );
-#endif
-                /* Calculate the bytes needed to be Written into FIFO (a incomplete byte will be added as 1byte) */
-                gRFAL.nfcvData.nfcvOffset = 0;
-                ret = iso15693VCDCode(gRFAL.TxRx.ctx.txBuf, rfalConvBitsToBytes(gRFAL.TxRx.ctx.txBufLen), (((gRFAL.nfcvData.origCtx.flags & (uint32_t)RFAL_TXRX_FLAGS_CRC_TX_MANUAL) != 0U)?false:true),(((gRFAL.nfcvData.origCtx.flags & (uint32_t)RFAL_TXRX_FLAGS_NFCV_FLAG_MANUAL) != 0U)?false:true), (RFAL_MODE_POLL_PICOPASS == gRFAL.mode),
-                          &gRFAL.fifo.bytesTotal, &gRFAL.nfcvData.nfcvOffset, gRFAL.nfcvData.codingBuffer, MIN( (uint16_t)ST25R3916_FIFO_DEPTH, (uint16_t)sizeof(gRFAL.nfcvData.codingBuffer) ), &gRFAL.fifo.bytesWritten);
-
-                if( (ret != ERR_NONE) && (ret != ERR_AGAIN) )
-                {
-                    gRFAL.TxRx.status = ret;
-                    gRFAL.TxRx.state  = RFAL_TXRX_STATE_TX_FAIL;
-                    break;
-                }
-                /* Set the number of full bytes and bits to be transmitted */
-                st25r3916SetNumTxBits( (uint16_t)rfalConvBytesToBits(gRFAL.fifo.bytesTotal) );
-
-                /* Load FIFO with coded bytes */
-                st25r3916WriteFifo( gRFAL.nfcvData.codingBuffer, gRFAL.fifo.bytesWritten );
-
+                /* Clear FIFO, Clear and Enable the Interrupts */
+                gRFAL.TxRx.staged = false;
+                rfalPrepareTransceive( );
+                
+                /* Send the FIFO load and transmission trigger recorded while waiting */
+                ret = st25r3916StageCommit();
             }
-            /*******************************************************************************/
             else
-        #endif /* RFAL_FEATURE_NFCV */
             {
-                /* Calculate the bytes needed to be Written into FIFO (a incomplete byte will be added as 1byte) */
-                gRFAL.fifo.bytesTotal = (uint16_t)rfalCalcNumBytes(gRFAL.TxRx.ctx.txBufLen);
+                /* Clear FIFO, Clear and Enable the Interrupts */
+                rfalPrepareTransceive( );
                 
-                /* Set the number of full bytes and bits to be transmitted */
-                st25r3916SetNumTxBits( gRFAL.TxRx.ctx.txBufLen );
-                
-                /* Load FIFO with total length or FIFO's maximum */
-                gRFAL.fifo.bytesWritten = MIN( gRFAL.fifo.bytesTotal, ST25R3916_FIFO_DEPTH );
-                st25r3916WriteFifo( gRFAL.TxRx.ctx.txBuf, gRFAL.fifo.bytesWritten );
+                /* Load the FIFO and trigger the transmission */
+                ret = rfalTransceiveLoadTx();
             }
-        
-            /*Check if Observation Mode is enabled and set it on ST25R391x */
-            rfalCheckEnableObsModeTx();
             
-            
-            /*******************************************************************************/
-            /* If we're in Passive Listen mode ensure that the external field is still On  */
-            if( rfalIsModePassiveListen(gRFAL.mode) )
+            if( batch )
             {
-                if( !rfalIsExtFieldOn() )
-                {
-                    gRFAL.TxRx.status = ERR_LINK_LOSS;
-                    gRFAL.TxRx.state  = RFAL_TXRX_STATE_TX_FAIL;
-                    break;
-                }
+                st25r3916BatchEnd();
             }
             
-            /*******************************************************************************/
-            /* Trigger/Start transmission                                                  */
-            if( (gRFAL.TxRx.ctx.flags & (uint32_t)RFAL_TXRX_FLAGS_CRC_TX_MANUAL) != 0U )
-            {
-                st25r3916ExecuteCommand( ST25R3916_CMD_TRANSMIT_WITHOUT_CRC );
-            }
-            else
+            if( ret != ERR_NONE )
             {
-                st25r3916ExecuteCommand( ST25R3916_CMD_TRANSMIT_WITH_CRC );
+                gRFAL.TxRx.status = ret;
+                gRFAL.TxRx.state  = RFAL_TXRX_STATE_TX_FAIL;
+                break;
             }
              
             /* Check if a WL level is expected or TXE should come */
@@ -2018,6 +2530,18 @@ static void rfalTransceiveTx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_TX_RELOAD_FIFO:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
+            /* The FIFO status kept by the ISR holds the FWL level, on fast frames read the *
+             * live level instead as the FIFO kept draining since the WL interrupt          */
+            if( gRFAL.fifo.adaptive )
+            {
+                rfalFIFOStatusClear();
+                st25r3916ReadMultipleRegisters( ST25R3916_REG_FIFO_STATUS1, gRFAL.fifo.status, ST25R3916_FIFO_STATUS_LEN );
+            }
+            
+            level = rfalFIFOStatusGetNumBytes();
+            rfalFIFOMarginsUpdate( true, level );
+            rfalFIFOStatusClear();
+            
         #if RFAL_FEATURE_NFCV
             /*******************************************************************************/
             /* In NFC-V streaming mode, the FIFO needs to be loaded with the coded bits    */
@@ -2048,11 +2572,21 @@ static void rfalTransceiveTx( void )
             else
         #endif /* RFAL_FEATURE_NFCV */
             {
+                tmp = gRFAL.fifo.expWL;
+                
+                if( gRFAL.fifo.adaptive )
+                {
+                    /* Fill all the free FIFO space in one burst */
+                    tmp = (uint16_t)( (level < ST25R3916_FIFO_DEPTH) ? (ST25R3916_FIFO_DEPTH - level) : 0U );
+                }
+                
                 /* Load FIFO with the remaining length or maximum available */
-                tmp = MIN( (gRFAL.fifo.bytesTotal - gRFAL.fifo.bytesWritten), gRFAL.fifo.expWL);       /* tmp holds the number of bytes written on this iteration */
+                tmp = MIN( (gRFAL.fifo.bytesTotal - gRFAL.fifo.bytesWritten), tmp);                    /* tmp holds the number of bytes written on this iteration */
                 st25r3916WriteFifo( &gRFAL.TxRx.ctx.txBuf[gRFAL.fifo.bytesWritten], tmp );
             }
             
+            gRFAL.fifo.margins.bursts++;
+            
             /* Update total written bytes to FIFO */
             gRFAL.fifo.bytesWritten += tmp;
             
@@ -2159,9 +2693,16 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_RX_IDLE:
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_RXS );
+            
             /* Clear rx counters */
             gRFAL.fifo.bytesWritten   = 0;            /* Total bytes written on RxBuffer         */
             gRFAL.fifo.bytesTotal     = 0;            /* Total bytes in FIFO will now be from Rx */
+            gRFAL.fifo.adaptive       = rfalFIFOIsAdaptive( gRFAL.rxBR, (uint16_t)rfalConvBitsToBytes(gRFAL.TxRx.ctx.rxBufLen) );
+            
+            /* Discard any FIFO status kept by the ISR on a Tx WL interrupt */
+            rfalFIFOStatusClear();
+            
             if( gRFAL.TxRx.ctx.rxRcvdLen != NULL )
             {
                 *gRFAL.TxRx.ctx.rxRcvdLen = 0;
@@ -2174,6 +2715,8 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/
         case RFAL_TXRX_STATE_RX_WAIT_RXS:
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_RXS );
+            
             /*******************************************************************************/
             irqs = st25r3916GetInterrupt( (ST25R3916_IRQ_MASK_RXS | ST25R3916_IRQ_MASK_NRE | ST25R3916_IRQ_MASK_EOF) );
             if( irqs == ST25R3916_IRQ_MASK_NONE )
@@ -2225,6 +2768,8 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/    
         case RFAL_TXRX_STATE_RX_WAIT_RXE:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_RXE );
+            
         
             /*******************************************************************************/
             /* REMARK: Silicon workaround ST25R3916 Errata #TBD                            */
@@ -2300,6 +2845,8 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/    
         case RFAL_TXRX_STATE_RX_ERR_CHECK:   /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
             
+            rfalProfMark( RFAL_PROF_PHASE_READ_FIFO );
+            
             if( (irqs & ST25R3916_IRQ_MASK_ERR1) != 0U )
             {
                 gRFAL.TxRx.status = ERR_FRAMING;
@@ -2508,6 +3055,8 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/    
         case RFAL_TXRX_STATE_RX_READ_FIFO:
             
+            rfalProfMark( RFAL_PROF_PHASE_READ_FIFO );
+            
             /*******************************************************************************/
             /* REMARK: Silicon workaround ST25R3916 Errata #TBD                            */
             /* Rarely on corrupted frames I_rxs gets signaled but I_rxe is not signaled    */
@@ -2515,7 +3064,17 @@ static void rfalTransceiveRx( void )
             rfalTimerStart( gRFAL.tmr.RXE, RFAL_NORXE_TOUT );
             /*******************************************************************************/
             
+            /* The FIFO status kept by the ISR holds the WL level, on fast frames read the *
+             * live level instead to drain all bytes received meanwhile in one burst       */
+            if( gRFAL.fifo.adaptive )
+            {
+                rfalFIFOStatusClear();
+                st25r3916ReadMultipleRegisters( ST25R3916_REG_FIFO_STATUS1, gRFAL.fifo.status, ST25R3916_FIFO_STATUS_LEN );
+            }
+            
             tmp = rfalFIFOStatusGetNumBytes();
+            rfalFIFOMarginsUpdate( false, tmp );
+            gRFAL.fifo.margins.bursts++;
             gRFAL.fifo.bytesTotal += tmp;
             
             /*******************************************************************************/
@@ -2563,6 +3122,8 @@ static void rfalTransceiveRx( void )
         /*******************************************************************************/    
         case RFAL_TXRX_STATE_RX_WAIT_EON:
             
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_RXS );
+            
             irqs = st25r3916GetInterrupt( (ST25R3916_IRQ_MASK_EON | ST25R3916_IRQ_MASK_NRE | ST25R3916_IRQ_MASK_PPON2) );
             if( irqs == ST25R3916_IRQ_MASK_NONE )
             {    
@@ -2589,6 +3150,8 @@ static void rfalTransceiveRx( void )
         
         /*******************************************************************************/    
         case RFAL_TXRX_STATE_RX_WAIT_EOF:
+            
+            rfalProfMark( RFAL_PROF_PHASE_WAIT_RXE );
            
             irqs = st25r3916GetInterrupt( (ST25R3916_IRQ_MASK_CAT | ST25R3916_IRQ_MASK_CAC) );
             if( irqs == ST25R3916_IRQ_MASK_NONE )
@@ -2626,7 +3189,11 @@ static void rfalFIFOStatusUpdate( void )
 {
     if(gRFAL.fifo.status[RFAL_FIFO_STATUS_REG2] == RFAL_FIFO_STATUS_INVALID)
     {
-        st25r3916ReadMultipleRegisters( ST25R3916_REG_FIFO_STATUS1, gRFAL.fifo.status, ST25R3916_FIFO_STATUS_LEN );
+        /* Use the FIFO status read by the ISR along with RXE or FWL if available */
+        if( !st25r3916GetInterruptFifoStatus( gRFAL.fifo.status ) )
+        {
+            st25r3916ReadMultipleRegisters( ST25R3916_REG_FIFO_STATUS1, gRFAL.fifo.status, ST25R3916_FIFO_STATUS_LEN );
+        }
     }
 }
 
@@ -2634,6 +3201,7 @@ static void rfalFIFOStatusUpdate( void )
 /*******************************************************************************/
 static void rfalFIFOStatusClear( void )
 {
+    st25r3916ClearInterruptFifoStatus();
     gRFAL.fifo.status[RFAL_FIFO_STATUS_REG2] = RFAL_FIFO_STATUS_INVALID;
 }
 
@@ -2675,6 +3243,173 @@ static uint8_t rfalFIFOGetNumIncompleteBits( void )
 }
 
 
+/*******************************************************************************/
+static bool rfalFIFOIsAdaptive( rfalBitRate br, uint16_t len )
+{
+    /* NFC-V and other sub-106 bit rates are never fast enough to need it */
+    return ( (gRFAL.conf.fifoWL.strategy == RFAL_FIFO_WL_ADAPTIVE) && (br <= RFAL_BR_13560) && 
+             (br >= gRFAL.conf.fifoWL.minBR) && (len >= gRFAL.conf.fifoWL.minLen) );
+}
+
+
+/*******************************************************************************/
+static void rfalFIFOMarginsUpdate( bool isTx, uint16_t level )
+{
+    uint16_t freeSpace;
+    
+    if( isTx )
+    {
+        /* On Tx the bytes still in FIFO is the time left before an underrun */
+        gRFAL.fifo.margins.txMinLevel = MIN( gRFAL.fifo.margins.txMinLevel, level );
+        
+        if( (gRFAL.fifo.status[RFAL_FIFO_STATUS_REG2] & ST25R3916_REG_FIFO_STATUS2_fifo_unf) != 0U )
+        {
+            gRFAL.fifo.margins.underruns++;
+        }
+    }
+    else
+    {
+        /* On Rx the free FIFO space is the time left before an overrun */
+        freeSpace = (uint16_t)( (level < ST25R3916_FIFO_DEPTH) ? (ST25R3916_FIFO_DEPTH - level) : 0U );
+        gRFAL.fifo.margins.rxMinFree = MIN( gRFAL.fifo.margins.rxMinFree, freeSpace );
+        
+        if( (gRFAL.fifo.status[RFAL_FIFO_STATUS_REG2] & ST25R3916_REG_FIFO_STATUS2_fifo_ovr) != 0U )
+        {
+            gRFAL.fifo.margins.overruns++;
+        }
+    }
+}
+
+
+/*******************************************************************************/
+static void rfalFIFOMarginsClear( void )
+{
+    gRFAL.fifo.margins.txMinLevel = ST25R3916_FIFO_DEPTH;
+    gRFAL.fifo.margins.rxMinFree  = ST25R3916_FIFO_DEPTH;
+    gRFAL.fifo.margins.underruns  = 0U;
+    gRFAL.fifo.margins.overruns   = 0U;
+    gRFAL.fifo.margins.bursts     = 0U;
+}
+
+
+#if RFAL_FEATURE_PROFILER
+/*******************************************************************************/
+static void rfalProfStart( void )
+{
+    gRFAL.prof.start      = platformGetSysTickNs();
+    gRFAL.prof.phaseStart = gRFAL.prof.start;
+    gRFAL.prof.phase      = RFAL_PROF_PHASE_WAIT_GT;
+    gRFAL.prof.visited    = (uint8_t)(1U << (uint8_t)RFAL_PROF_PHASE_WAIT_GT);
+    gRFAL.prof.active     = true;
+    
+    ST_MEMSET( gRFAL.prof.phaseNs, 0x00, sizeof(gRFAL.prof.phaseNs) );
+}
+
+
+/*******************************************************************************/
+static void rfalProfEnter( rfalProfPhase phase )
+{
+    uint64_t now;
+    
+    /* Only a phase change is timed, states are run again on every worker call */
+    if( !gRFAL.prof.active || (phase == gRFAL.prof.phase) )
+    {
+        return;
+    }
+    
+    now = platformGetSysTickNs();
+    gRFAL.prof.phaseNs[gRFAL.prof.phase] += (now - gRFAL.prof.phaseStart);
+    gRFAL.prof.phaseStart = now;
+    gRFAL.prof.phase      = phase;
+    gRFAL.prof.visited   |= (uint8_t)(1U << (uint8_t)phase);
+}
+
+
+/*******************************************************************************/
+static void rfalProfDone( void )
+{
+    uint64_t       now;
+    uint8_t        i;
+    rfalProfStats *st;
+    
+    if( !gRFAL.prof.active || (gRFAL.TxRx.state != RFAL_TXRX_STATE_IDLE) )
+    {
+        return;
+    }
+    
+    now = platformGetSysTickNs();
+    gRFAL.prof.phaseNs[gRFAL.prof.phase] += (now - gRFAL.prof.phaseStart);
+    gRFAL.prof.active = false;
+    
+    /* Look for the entry of the current mode and bit rates, or take a new one */
+    st = NULL;
+    for( i = 0; i < gRFAL.prof.statsCnt; i++ )
+    {
+        if( (gRFAL.prof.stats[i].mode == gRFAL.mode) && (gRFAL.prof.stats[i].txBR == gRFAL.txBR) && (gRFAL.prof.stats[i].rxBR == gRFAL.rxBR) )
+        {
+            st = &gRFAL.prof.stats[i];
+            break;
+        }
+    }
+    
+    if( st == NULL )
+    {
+        if( gRFAL.prof.statsCnt >= RFAL_PROF_MAX_STATS )
+        {
+            return;   /* No room for another combination, it is not timed */
+        }
+        
+        st = &gRFAL.prof.stats[gRFAL.prof.statsCnt++];
+        st->mode = gRFAL.mode;
+        st->txBR = gRFAL.txBR;
+        st->rxBR = gRFAL.rxBR;
+    }
+    
+    if( gRFAL.TxRx.status != ERR_NONE )
+    {
+        st->errors++;
+    }
+    
+    for( i = 0; i < (uint8_t)RFAL_PROF_PHASE_TOTAL; i++ )
+    {
+        if( (gRFAL.prof.visited & (1U << i)) != 0U )
+        {
+            rfalProfRecord( &st->phase[i], gRFAL.prof.phaseNs[i] );
+        }
+    }
+    rfalProfRecord( &st->phase[RFAL_PROF_PHASE_TOTAL], (now - gRFAL.prof.start) );
+}
+
+
+/*******************************************************************************/
+static void rfalProfRecord( rfalProfPhaseStats *st, uint64_t ns )
+{
+    uint64_t us;
+    uint8_t  bucket;
+    
+    if( (st->count == 0U) || (ns < st->minNs) )
+    {
+        st->minNs = ns;
+    }
+    if( ns > st->maxNs )
+    {
+        st->maxNs = ns;
+    }
+    st->sumNs += ns;
+    st->count++;
+    
+    /* Bucket n holds [2^n ; 2^(n+1)[ us */
+    bucket = 0U;
+    us     = (ns / 1000U);
+    while( ((us >>= 1U) != 0U) && (bucket < (RFAL_PROF_HIST_LEN - 1U)) )
+    {
+        bucket++;
+    }
+    st->hist[bucket]++;
+}
+#endif /* RFAL_FEATURE_PROFILER */
+
+
 #if RFAL_FEATURE_NFCA
 
 /*******************************************************************************/
@@ -2732,6 +3467,7 @@ ReturnCode rfalISO14443ATransceiveShortFrame( rfal14443AShortFrameCmd txCmd, uin
     gRFAL.TxRx.ctx.rxBufLen  = rxBufLen;
     gRFAL.TxRx.ctx.rxRcvdLen = rxRcvdLen;
     gRFAL.TxRx.ctx.fwt       = fwt;
+    gRFAL.TxRx.ctx.callback  = NULL;
     
     /*******************************************************************************/
     /* Load NRT with FWT */
@@ -2844,6 +3580,8 @@ ReturnCode rfalISO14443ATransceiveAnticollisionFrame( uint8_t *buf, uint8_t *byt
     ctx.rxBufLen  = (uint16_t)rfalConvBytesToBits( RFAL_ISO14443A_SDD_RES_LEN );
     ctx.rxRcvdLen = rxLength;
     ctx.fwt       = fwt;
+    ctx.callback  = NULL;
+    ctx.userParam = NULL;
     
     /* Disable Automatic Gain Control (AGC) for better detection of collisions if using Coherent Receiver */
     ctx.flags    |= (st25r3916CheckReg( ST25R3916_REG_AUX, ST25R3916_REG_AUX_dis_corr, ST25R3916_REG_AUX_dis_corr ) ? (uint32_t)RFAL_TXRX_FLAGS_AGC_OFF : 0x00U );
@@ -2945,6 +3683,8 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
     ctx.rxBufLen  = (uint16_t)rfalConvBytesToBits(rxBufLen);
     ctx.rxRcvdLen = actLen;
     ctx.fwt       = rfalConv64fcTo1fc(ISO15693_FWT);
+    ctx.callback  = NULL;
+    ctx.userParam = NULL;
     
     rfalStartTransceive( &ctx );
     
@@ -2961,7 +3701,7 @@ ReturnCode rfalISO15693TransceiveAnticollisionFrame( uint8_t *txBuf, uint8_t txB
     {
         /* If INVENTORY_RES is shorter than expected, tag is still modulating *
          * Ensure that response is complete before next frame                 */
-        platformDelay( (uint8_t)( (RFAL_ISO15693_INV_RES_LEN - rfalConvBitsToBytes(*ctx.rxRcvdLen)) / ((RFAL_ISO15693_INV_RES_LEN / RFAL_ISO15693_INV_RES_DUR)+1U) ));
+        platformDelayUs( (((uint32_t)RFAL_ISO15693_INV_RES_LEN - rfalConvBitsToBytes(*ctx.rxRcvdLen)) * RFAL_ISO15693_INV_RES_DUR * RFAL_US_IN_MS) / RFAL_ISO15693_INV_RES_LEN );
     }
     
     /* Restore common Analog configurations for this mode */
@@ -3161,6 +3901,9 @@ ReturnCode rfalListenStart( uint32_t lmMask, const rfalLmConfPA *confA, const rf
         return ERR_WRONG_STATE;
     }
     
+    /* Listen Mode reprograms the mode and bit rate on its own */
+    rfalInvalidateMode();
+    
     gRFAL.Lm.state  = RFAL_LM_STATE_NOT_INIT;
     gRFAL.Lm.mdIrqs = ST25R3916_IRQ_MASK_NONE;
     gRFAL.Lm.mdReg  = (ST25R3916_REG_MODE_targ_init | ST25R3916_REG_MODE_om_nfc | ST25R3916_REG_MODE_nfc_ar_off);
@@ -3719,6 +4462,7 @@ ReturnCode rfalListenStop( void )
     }
     
     gRFAL.Lm.state = RFAL_LM_STATE_NOT_INIT;
+    rfalInvalidateMode();
     
     /*Check if Observation Mode was enabled and disable it on ST25R391x */
     rfalCheckDisableObsMode();
@@ -3754,6 +4498,8 @@ ReturnCode rfalListenSleepStart( rfalLmState sleepSt, uint8_t *rxBuf, uint16_t r
         return ERR_WRONG_STATE;
     }
     
+    rfalInvalidateMode();
+    
     switch(sleepSt)
     {
         /*******************************************************************************/
@@ -3868,6 +4614,7 @@ ReturnCode rfalListenSetState( rfalLmState newSt )
     
     /* SetState clears the Data flag */
     gRFAL.Lm.dataFlag = false;
+    rfalInvalidateMode();
     newState          = newSt;
     ret               = ERR_NONE;
 
@@ -4139,6 +4886,9 @@ ReturnCode rfalWakeUpModeStart( const rfalWakeUpConfig *config )
     }
     
     
+    /* Wake-Up Mode reprograms the mode on its own */
+    rfalInvalidateMode();
+    
     /* The Wake-Up procedure is explained in detail in Application Note: AN4985 */
     
     if( config == NULL )
@@ -4544,6 +5294,7 @@ ReturnCode rfalLowPowerModeStart( void )
     
     /* Stop any ongoing activity and set the device in low power by disabling oscillator, transmitter, receiver and external field detector */
     st25r3916ExecuteCommand( ST25R3916_CMD_STOP );
+    rfalInvalidateMode();
     st25r3916ClrRegisterBits( ST25R3916_REG_OP_CONTROL, ( ST25R3916_REG_OP_CONTROL_en | ST25R3916_REG_OP_CONTROL_rx_en | 
                                                           ST25R3916_REG_OP_CONTROL_wu | ST25R3916_REG_OP_CONTROL_tx_en | 
                                                           ST25R3916_REG_OP_CONTROL_en_fd_mask                          ) );
@@ -4609,6 +5360,33 @@ ReturnCode rfalChipReadReg( uint16_t reg, uint8_t* values, uint8_t len )
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalChipChangeRegBitsMultiple( uint16_t reg, const uint8_t* valueMasks, const uint8_t* values, uint8_t len )
+{
+    ReturnCode ret;
+    uint8_t    i;
+    
+    for( i = 0; i < len; i++ )
+    {
+        if( !st25r3916IsRegValid( (uint8_t)(reg + i) ) )
+        {
+            return ERR_PARAM;
+        }
+    }
+    
+    /* Space-A and space-B registers cannot be accessed at once */
+    if( ((reg & ST25R3916_SPACE_B) == 0U) && ((reg + len) > ST25R3916_SPACE_B) )
+    {
+        i = (uint8_t)(ST25R3916_SPACE_B - reg);
+        
+        EXIT_ON_ERR( ret, st25r3916ChangeMultipleRegisterBits( (uint8_t)reg, valueMasks, values, i ) );
+        return st25r3916ChangeMultipleRegisterBits( ST25R3916_SPACE_B, &valueMasks[i], &values[i], (len - i) );
+    }
+    
+    return st25r3916ChangeMultipleRegisterBits( (uint8_t)reg, valueMasks, values, len );
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalChipExecCmd( uint16_t cmd )
 {
@@ -4617,10 +5395,30 @@ ReturnCode rfalChipExecCmd( uint16_t cmd )
         return ERR_PARAM;
     }
     
+    /* Set Default resets all registers, mode and bit rate must be applied again */
+    if( cmd == ST25R3916_CMD_SET_DEFAULT )
+    {
+        rfalInvalidateMode();
+    }
+    
     return st25r3916ExecuteCommand( (uint8_t) cmd );
 }
 
 
+/*******************************************************************************/
+ReturnCode rfalChipBatchStart( void )
+{
+    return st25r3916BatchStart();
+}
+
+
+/*******************************************************************************/
+ReturnCode rfalChipBatchEnd( void )
+{
+    return st25r3916BatchEnd();
+}
+
+
 /*******************************************************************************/
 ReturnCode rfalChipWriteTestReg( uint16_t reg, uint8_t value )
 {
@@ -72,19 +72,35 @@
 #define ST25R3916_TEST_TMR_TOUT_DELTA             2U      /*!< Timeout used during self test                                       */
 #define ST25R3916_TEST_TMR_TOUT_8FC               (ST25R3916_TEST_TMR_TOUT * 16950U) /*!< Timeout in 8/fc                          */
 
+#ifndef ST25R_SPI_PROBE_MIN_FREQ
+    #define ST25R_SPI_PROBE_MIN_FREQ              1000000U  /*!< Lowest SPI clock tried by the SPI clock probe                     */
+#endif
+#ifndef ST25R_SPI_PROBE_MAX_FREQ
+    #define ST25R_SPI_PROBE_MAX_FREQ              10000000U /*!< Highest SPI clock tried by the SPI clock probe  Datasheet: 10MHz  */
+#endif
+#ifndef ST25R_SPI_PROBE_STEP
+    #define ST25R_SPI_PROBE_STEP                  1000000U  /*!< SPI clock increment used by the SPI clock probe                   */
+#endif
+
 /*
 ******************************************************************************
 * LOCAL CONSTANTS
 ******************************************************************************
 */
 
+#ifdef platformSpiSetFrequency
+/*! Write/readback patterns used by the SPI clock probe */
+static const uint8_t st25r3916SpiProbePatterns[][2] = { {0x55U, 0xAAU}, {0xAAU, 0x55U}, {0x33U, 0xCCU}, {0x00U, 0xFFU}, {0xFFU, 0x00U}, {0x0FU, 0xF0U} };
+#endif /* platformSpiSetFrequency */
+
 /*
 ******************************************************************************
 * LOCAL VARIABLES
 ******************************************************************************
 */
 
-static uint32_t gST25R3916NRT_64fcs;
+static uint32_t gST25R3916NRT_64fcsInst[ST25R_MAX_INSTANCES];                  /*!< NRT in steps of 64/fc, one per ST25R3916 */
+#define gST25R3916NRT_64fcs    (gST25R3916NRT_64fcsInst[platformGetInstance()])  /*!< NRT in steps of 64/fc of the caller     */
 
 /*
 ******************************************************************************
@@ -92,6 +108,30 @@ static uint32_t gST25R3916NRT_64fcs;
 ******************************************************************************
 */
 
+/*!
+ *****************************************************************************
+ * \brief  Set the ST25R3916 registers to their initial setup
+ *
+ * Sets the default state on the ST25R3916 and applies the interface and
+ * test register configuration done on initialization
+ *****************************************************************************
+ */
+static void st25r3916SetupRegisters( void );
+
+#ifdef platformSpiSetFrequency
+/*!
+ *****************************************************************************
+ * \brief  Check SPI communication at current clock
+ *
+ * Writes known patterns to the General Purpose Timer registers as a burst
+ * and checks the values read back, also verifies the IC Identity
+ *
+ * \return  true when all patterns are read back correctly
+ *****************************************************************************
+ */
+static bool st25r3916SpiProbeCheck( void );
+#endif /* platformSpiSetFrequency */
+
 /*
  ******************************************************************************
  * LOCAL FUNCTION
@@ -119,6 +159,54 @@ ReturnCode st25r3916ExecuteCommandAndGetResult( uint8_t cmd, uint8_t resReg, uin
 
 }
 
+/*******************************************************************************/
+static void st25r3916SetupRegisters( void )
+{
+    /* Set default state on the ST25R3916 */
+    st25r3916ExecuteCommand( ST25R3916_CMD_SET_DEFAULT );
+
+#ifndef RFAL_USE_I2C
+    /* Increase MISO driving level as SPI can go up to 10MHz */
+    st25r3916WriteRegister(ST25R3916_REG_IO_CONF2, ST25R3916_REG_IO_CONF2_io_drv_lvl);
+    
+    /* Enable pull downs on MISO line */
+    st25r3916SetRegisterBits(ST25R3916_REG_IO_CONF2, ( ST25R3916_REG_IO_CONF2_miso_pd1 | ST25R3916_REG_IO_CONF2_miso_pd2 ) );
+#endif /* RFAL_USE_I2C */
+
+    /* Disable internal overheat protection */
+    st25r3916ChangeTestRegisterBits( 0x04, 0x10, 0x10 );
+}
+
+#ifdef platformSpiSetFrequency
+/*******************************************************************************/
+static bool st25r3916SpiProbeCheck( void )
+{
+    uint8_t i;
+    uint8_t rdVal[2];
+    
+    if( !st25r3916CheckChipID( NULL ) )
+    {
+        return false;
+    }
+    
+    for( i = 0; i < SIZEOF_ARRAY(st25r3916SpiProbePatterns); i++ )
+    {
+        rdVal[0] = (uint8_t)~st25r3916SpiProbePatterns[i][0];
+        rdVal[1] = (uint8_t)~st25r3916SpiProbePatterns[i][1];
+        
+        st25r3916WriteMultipleRegisters( ST25R3916_REG_GPT1, st25r3916SpiProbePatterns[i], 2 );
+        st25r3916ReadMultipleRegisters( ST25R3916_REG_GPT1, rdVal, 2 );
+        
+        if( (rdVal[0] != st25r3916SpiProbePatterns[i][0]) || (rdVal[1] != st25r3916SpiProbePatterns[i][1]) )
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+#endif /* platformSpiSetFrequency */
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -130,13 +218,8 @@ ReturnCode st25r3916Initialize( void )
     uint16_t vdd_mV;
     ReturnCode ret;
 
-    /* Set default state on the ST25R3916 */
-    st25r3916ExecuteCommand( ST25R3916_CMD_SET_DEFAULT );
-
-#ifndef RFAL_USE_I2C
-    /* Increase MISO driving level as SPI can go up to 10MHz */
-    st25r3916WriteRegister(ST25R3916_REG_IO_CONF2, ST25R3916_REG_IO_CONF2_io_drv_lvl);
-#endif /* RFAL_USE_I2C */
+    /* Set default state on the ST25R3916 and apply the initial register setup */
+    st25r3916SetupRegisters();
 
     if( !st25r3916CheckChipID( NULL ) )
     {
@@ -150,13 +233,10 @@ ReturnCode st25r3916Initialize( void )
 
     gST25R3916NRT_64fcs = 0;
 
-#ifndef RFAL_USE_I2C
-    /* Enable pull downs on MISO line */
-    st25r3916SetRegisterBits(ST25R3916_REG_IO_CONF2, ( ST25R3916_REG_IO_CONF2_miso_pd1 | ST25R3916_REG_IO_CONF2_miso_pd2 ) );
-#endif /* RFAL_USE_I2C */
-
-    /* Disable internal overheat protection */
-    st25r3916ChangeTestRegisterBits( 0x04, 0x10, 0x10 );
+#ifdef ST25R_SPI_PROBE
+    /* Look for the highest reliable SPI clock */
+    EXIT_ON_ERR( ret, st25r3916ProbeSpiFrequency( NULL ) );
+#endif /* ST25R_SPI_PROBE */
 
 #ifdef ST25R_SELFTEST
     /******************************************************************************
@@ -656,6 +736,70 @@ bool st25r3916CheckChipID( uint8_t *rev )
 }
 
 
+/*******************************************************************************/
+ReturnCode st25r3916ProbeSpiFrequency( uint32_t* freq )
+{
+#ifdef platformSpiSetFrequency
+    uint8_t  gpt[2];
+    uint32_t regFreq;
+    uint32_t fifoFreq;
+    uint32_t probeFreq;
+    uint32_t goodFreq;
+    
+    platformSpiGetFrequency( &regFreq, &fifoFreq );
+    st25r3916ReadMultipleRegisters( ST25R3916_REG_GPT1, gpt, 2 );
+    
+    /* Raise the clock step by step until communication is no longer reliable */
+    goodFreq = 0;
+    for( probeFreq = ST25R_SPI_PROBE_MIN_FREQ; probeFreq <= ST25R_SPI_PROBE_MAX_FREQ; probeFreq += ST25R_SPI_PROBE_STEP )
+    {
+        if( platformSpiSetFrequency( probeFreq, probeFreq ) != HAL_OK )
+        {
+            break;
+        }
+        
+        if( !st25r3916SpiProbeCheck() )
+        {
+            break;
+        }
+        
+        goodFreq = probeFreq;
+    }
+    
+    /* Apply the highest reliable clock, keep the previous on failure */
+    if( goodFreq == 0U )
+    {
+        platformSpiSetFrequency( regFreq, fifoFreq );
+    }
+    else
+    {
+        platformSpiSetFrequency( goodFreq, goodFreq );
+    }
+    
+    /* A failing check may have corrupted any register, not only the GPT ones: *
+     * restore the initial register setup and drop the shadowed values         */
+    st25r3916SetupRegisters();
+    st25r3916ShadowInvalidate();
+    st25r3916WriteMultipleRegisters( ST25R3916_REG_GPT1, gpt, 2 );
+    
+    if( goodFreq == 0U )
+    {
+        return ERR_IO;
+    }
+    
+    if( freq != NULL )
+    {
+        *freq = goodFreq;
+    }
+    
+    return ERR_NONE;
+#else
+    NO_WARNING( freq );
+    return ERR_NOTSUPP;
+#endif /* platformSpiSetFrequency */
+}
+
+
 /*******************************************************************************/
 ReturnCode st25r3916GetRegsDump( t_st25r3916Regs* regDump )
 {
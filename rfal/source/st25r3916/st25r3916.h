@@ -517,6 +517,28 @@ ReturnCode st25r3916PerformCollisionAvoidance( uint8_t FieldONCmd, uint8_t pdThr
  */
 bool st25r3916CheckChipID( uint8_t *rev );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Probe SPI clock
+ *
+ *  Raises the SPI clock step by step from ST25R_SPI_PROBE_MIN_FREQ up to 
+ *  ST25R_SPI_PROBE_MAX_FREQ checking at each step the IC identity and 
+ *  write/readback of known patterns. The highest clock passing all checks
+ *  is applied to both register and FIFO transfers.
+ *  As a failing check may corrupt any register the ST25R3916 is set back
+ *  to its default state and initial register setup afterwards, it shall
+ *  therefore be called before the ST25R3916 is configured.
+ *  Enabled on initialization by ST25R_SPI_PROBE
+ *   
+ *  \param[out] freq : the selected SPI clock in Hz, NULL if not needed
+ *    
+ *  \return  ERR_NOTSUPP : Platform does not support setting the SPI clock
+ *  \return  ERR_IO      : No reliable SPI clock found, previous clock kept
+ *  \return  ERR_NONE    : No error
+ *****************************************************************************
+ */
+ReturnCode st25r3916ProbeSpiFrequency( uint32_t* freq );
+
 /*! 
  *****************************************************************************
  *  \brief  Retrieves all  internal registers from ST25R3916
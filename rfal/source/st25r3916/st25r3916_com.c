@@ -44,6 +44,7 @@
 #include "st25r3916.h"
 #include "st25r3916_com.h"
 #include "st25r3916_led.h"
+#include "st25r3916_irq.h"
 #include "st_errno.h"
 #include "platform.h"
 #include "utils.h"
@@ -72,6 +73,20 @@
 #define ST25R3916_CMD_LEN               (1U)                           /*!< ST25R3916 CMD length                                           */
 #define ST25R3916_BUF_LEN               (ST25R3916_CMD_LEN+ST25R3916_FIFO_DEPTH) /*!< ST25R3916 communication buffer: CMD + FIFO length    */
 
+#define ST25R3916_SHADOW_LEN            (ST25R3916_SPACE_B << 1)       /*!< Shadow entries: space-A and space-B registers                  */
+#define ST25R3916_SHADOW_TEST_LEN       (ST25R3916_SPACE_B)            /*!< Shadow entries: test registers                                 */
+
+#if defined(platformSpiBatchAdd) && defined(ST25R_COM_SINGLETXRX) && !defined(RFAL_USE_I2C)
+    #define ST25R3916_COM_BATCH                                        /*!< Platform supports queuing several SPI frames in one transfer  */
+#endif /* platformSpiBatchAdd */
+
+#if defined(ST25R_COM_SINGLETXRX) && !defined(RFAL_USE_I2C)
+    #define ST25R3916_COM_STAGE                                        /*!< Write frames can be recorded and sent later                   */
+#endif /* ST25R_COM_SINGLETXRX */
+
+#define ST25R3916_STAGE_LEN             (ST25R3916_BUF_LEN + 256U)     /*!< Staging buffer: a FIFO load plus the frames around it          */
+#define ST25R3916_STAGE_HDR_LEN         2U                             /*!< Length header of each frame on the staging buffer              */
+
 /*
 ******************************************************************************
 * MACROS
@@ -87,9 +102,61 @@
 
 
 #if defined(ST25R_COM_SINGLETXRX) && !defined(RFAL_USE_I2C)
-static uint8_t  comBuf[ST25R3916_BUF_LEN];                             /*!< ST25R3916 communication buffer                                 */
-static uint16_t comBufIt;                                              /*!< ST25R3916 communication buffer iterator                        */
+static uint8_t  comBufInst[ST25R_MAX_INSTANCES][ST25R3916_BUF_LEN];    /*!< ST25R3916 communication buffers, one per ST25R3916             */
+static uint16_t comBufItInst[ST25R_MAX_INSTANCES];                     /*!< ST25R3916 communication buffer iterators                       */
+
+#define comBuf      (comBufInst[platformGetInstance()])                /*!< ST25R3916 communication buffer of the caller                   */
+#define comBufIt    (comBufItInst[platformGetInstance()])              /*!< ST25R3916 communication buffer iterator of the caller          */
 #endif /* ST25R_COM_SINGLETXRX */
+
+#ifdef ST25R_COM_SHADOW
+
+/*! Shadow copy of the ST25R3916 registers */
+typedef struct
+{
+    uint8_t  regs[ST25R3916_SHADOW_LEN];                               /*!< Last known value of space-A/space-B registers                  */
+    bool     valid[ST25R3916_SHADOW_LEN];                              /*!< Register value on shadow is valid                              */
+    uint8_t  testRegs[ST25R3916_SHADOW_TEST_LEN];                      /*!< Last known value of test registers                             */
+    bool     testValid[ST25R3916_SHADOW_TEST_LEN];                     /*!< Test register value on shadow is valid                         */
+    bool     staged[ST25R3916_SHADOW_LEN];                             /*!< Register written by a staged frame not yet sent                */
+    bool     testStaged[ST25R3916_SHADOW_TEST_LEN];                    /*!< Test register written by a staged frame not yet sent           */
+    uint32_t hits;                                                     /*!< Reads served from the shadow                                   */
+    uint32_t misses;                                                   /*!< Reads that required a bus access                               */
+} st25r3916Shadow;
+
+static st25r3916Shadow gST25R3916ShadowInst[ST25R_MAX_INSTANCES];      /*!< ST25R3916 register shadows, one per ST25R3916                  */
+#define gST25R3916Shadow    (gST25R3916ShadowInst[platformGetInstance()]) /*!< ST25R3916 register shadow of the caller                     */
+
+#endif /* ST25R_COM_SHADOW */
+
+#ifdef ST25R3916_COM_BATCH
+static bool     comBatchOpenInst[ST25R_MAX_INSTANCES];                 /*!< ST25R3916 communication batch open (access under comm lock)    */
+#define comBatchOpen    (comBatchOpenInst[platformGetInstance()])      /*!< ST25R3916 communication batch open of the caller               */
+#endif /* ST25R3916_COM_BATCH */
+
+#ifdef ST25R3916_COM_STAGE
+
+/*! Write frames recorded to be sent later */
+typedef struct
+{
+    uint8_t  buf[ST25R3916_STAGE_LEN];                                 /*!< Recorded frames, each preceded by its length                   */
+    uint16_t len;                                                      /*!< Bytes used on buf                                              */
+    bool     recording;                                                /*!< Write frames are being recorded                                */
+    bool     overflow;                                                 /*!< A frame did not fit, the recording is incomplete               */
+} st25r3916Stage;
+
+static st25r3916Stage gST25R3916StageInst[ST25R_MAX_INSTANCES];        /*!< ST25R3916 staged frames, one per ST25R3916                     */
+#define gST25R3916Stage     (gST25R3916StageInst[platformGetInstance()]) /*!< ST25R3916 staged frames of the caller                        */
+
+#endif /* ST25R3916_COM_STAGE */
+
+#ifdef ST25R_COM_SHADOW
+#ifdef ST25R3916_COM_STAGE
+    #define st25r3916ShadowRecording()  (gST25R3916Stage.recording)     /*!< Writes are being recorded instead of sent                      */
+#else
+    #define st25r3916ShadowRecording()  (false)                         /*!< Writes are always sent                                         */
+#endif /* ST25R3916_COM_STAGE */
+#endif /* ST25R_COM_SHADOW */
     
 /*
  ******************************************************************************
@@ -176,6 +243,108 @@ static void st25r3916comRx( uint8_t* rxBuf, uint16_t rxLen );
  */
 static void st25r3916comTxByte( uint8_t txByte, bool last, bool txOnly );
 
+#ifdef ST25R3916_COM_STAGE
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 communication stage frame
+ * 
+ * Records a complete write frame on the staging buffer. If the frame does not
+ * fit the recording is flagged as incomplete and the frame is dropped
+ * 
+ * \param[in]   frame  : frame to be recorded
+ * \param[in]   length : frame length
+ ******************************************************************************
+ */
+static void st25r3916comStageAdd( const uint8_t* frame, uint16_t length );
+#endif /* ST25R3916_COM_STAGE */
+
+#ifdef ST25R_COM_SHADOW
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 shadow volatile register check
+ * 
+ * Checks whether the given register may be changed by the ST25R3916 itself
+ * (status, interrupt, FIFO, measurement results) and therefore must not be
+ * kept on the shadow
+ * 
+ * \param[in]   reg : register address (space-B registers flagged)
+ * 
+ * \return true if the register is volatile
+ ******************************************************************************
+ */
+static bool st25r3916ShadowIsVolatile( uint8_t reg );
+
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 shadow update
+ * 
+ * Stores the values written to/read from consecutive registers on the shadow.
+ * A recorded write is not on the ST25R3916 yet: its registers are invalidated
+ * and not refilled by reads until the staged frames are sent or discarded
+ * 
+ * \param[in]   reg    : first register address (space-B registers flagged)
+ * \param[in]   values : register values
+ * \param[in]   length : number of registers
+ * \param[in]   write  : true if the values are being written
+ ******************************************************************************
+ */
+static void st25r3916ShadowUpdate( uint8_t reg, const uint8_t* values, uint8_t length, bool write );
+
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 shadow test register update
+ * 
+ * Same as st25r3916ShadowUpdate() for a single test register
+ * 
+ * \param[in]   reg   : test register address
+ * \param[in]   value : register value
+ * \param[in]   write : true if the value is being written
+ ******************************************************************************
+ */
+static void st25r3916ShadowTestUpdate( uint8_t reg, uint8_t value, bool write );
+
+#ifdef ST25R3916_COM_STAGE
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 shadow unstage
+ * 
+ * Releases the registers held by staged frames, once sent or discarded
+ ******************************************************************************
+ */
+static void st25r3916ShadowUnstage( void );
+#endif /* ST25R3916_COM_STAGE */
+#endif /* ST25R_COM_SHADOW */
+
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 read register for read-modify-write
+ * 
+ * Retrieves the register value from the shadow when available, otherwise
+ * the register is read from the ST25R3916
+ * 
+ * \param[in]   reg : register address
+ * \param[out]  val : register value
+ * 
+ * \return ERR_NONE : Operation successful
+ ******************************************************************************
+ */
+static ReturnCode st25r3916ReadRegisterShadow( uint8_t reg, uint8_t* val );
+
+/*!
+ ******************************************************************************
+ * \brief ST25R3916 read test register for read-modify-write
+ * 
+ * Retrieves the test register value from the shadow when available, 
+ * otherwise the test register is read from the ST25R3916
+ * 
+ * \param[in]   reg : test register address
+ * \param[out]  val : test register value
+ * 
+ * \return ERR_NONE : Operation successful
+ ******************************************************************************
+ */
+static ReturnCode st25r3916ReadTestRegisterShadow( uint8_t reg, uint8_t* val );
+
 
 /*
  ******************************************************************************
@@ -249,6 +418,22 @@ static void st25r3916comTx( const uint8_t* txBuf, uint16_t txLen, bool last, boo
                 
             if( last && txOnly )                                                                    /* only perform SPI transaction if no Rx will follow */
             {
+            #ifdef ST25R3916_COM_STAGE
+                if( gST25R3916Stage.recording )
+                {
+                    st25r3916comStageAdd( comBuf, comBufIt );                                       /* record the frame, it is sent on commit            */
+                    return;
+                }
+            #endif /* ST25R3916_COM_STAGE */
+                
+            #ifdef ST25R3916_COM_BATCH
+                if( comBatchOpen )
+                {
+                    platformSpiBatchAdd( comBuf, NULL, comBufIt, true );                            /* queue the frame, it is sent on flush              */
+                    return;
+                }
+            #endif /* ST25R3916_COM_BATCH */
+                
                 platformSpiTxRx( comBuf, NULL, comBufIt );
             }
             
@@ -271,9 +456,24 @@ static void st25r3916comRx( uint8_t* rxBuf, uint16_t rxLen )
 #else /* RFAL_USE_I2C */
         
     #ifdef ST25R_COM_SINGLETXRX
+        #ifdef ST25R3916_COM_BATCH
+        if( comBatchOpen )
+        {
+            /* Queue the cmd bytes and the data read on the same frame and flush, Rx data is placed directly on the output buffer */
+            platformSpiBatchAdd( comBuf, NULL, comBufIt, false );
+            platformSpiBatchAdd( NULL, rxBuf, rxLen, true );
+            platformSpiBatchFlush();
+            return;
+        }
+        #endif /* ST25R3916_COM_BATCH */
+        
+        #ifdef platformSpiTxThenRx
+        platformSpiTxThenRx( comBuf, comBufIt, rxBuf, rxLen );                                  /* cmd bytes then receive directly on the output buffer   */
+        #else
         ST_MEMSET( &comBuf[comBufIt], 0x00, MIN( rxLen, (ST25R3916_BUF_LEN - comBufIt) ) );     /* clear outgoing buffer                                  */
         platformSpiTxRx( comBuf, comBuf, MIN( (comBufIt + rxLen), ST25R3916_BUF_LEN ) );        /* transceive as a single SPI call                        */
         ST_MEMCPY( rxBuf, &comBuf[comBufIt], MIN( rxLen, (ST25R3916_BUF_LEN - comBufIt) ) );    /* copy from local buf to output buffer and skip cmd byte */
+        #endif /* platformSpiTxThenRx */
     #else
         if( rxBuf != NULL)
         {
@@ -293,6 +493,176 @@ static void st25r3916comTxByte( uint8_t txByte, bool last, bool txOnly )
     st25r3916comTx( &val, ST25R3916_REG_LEN, last, txOnly );
 }
 
+
+#ifdef ST25R3916_COM_STAGE
+/*******************************************************************************/
+static void st25r3916comStageAdd( const uint8_t* frame, uint16_t length )
+{
+    if( gST25R3916Stage.overflow || ((gST25R3916Stage.len + ST25R3916_STAGE_HDR_LEN + length) > ST25R3916_STAGE_LEN) )
+    {
+        gST25R3916Stage.overflow = true;
+        return;
+    }
+    
+    gST25R3916Stage.buf[gST25R3916Stage.len++] = (uint8_t)(length >> 8U);
+    gST25R3916Stage.buf[gST25R3916Stage.len++] = (uint8_t)(length & 0xFFU);
+    ST_MEMCPY( &gST25R3916Stage.buf[gST25R3916Stage.len], frame, length );
+    gST25R3916Stage.len += length;
+}
+#endif /* ST25R3916_COM_STAGE */
+
+
+#ifdef ST25R_COM_SHADOW
+/*******************************************************************************/
+static bool st25r3916ShadowIsVolatile( uint8_t reg )
+{
+    switch( reg )
+    {
+        case ST25R3916_REG_OP_CONTROL:                    /* en/tx_en may be set by the chip (wake-up, collision avoidance) */
+        case ST25R3916_REG_IRQ_MAIN:
+        case ST25R3916_REG_IRQ_TIMER_NFC:
+        case ST25R3916_REG_IRQ_ERROR_WUP:
+        case ST25R3916_REG_IRQ_TARGET:
+        case ST25R3916_REG_FIFO_STATUS1:
+        case ST25R3916_REG_FIFO_STATUS2:
+        case ST25R3916_REG_COLLISION_STATUS:
+        case ST25R3916_REG_PASSIVE_TARGET_STATUS:
+        case ST25R3916_REG_NFCIP1_BIT_RATE:
+        case ST25R3916_REG_AD_RESULT:
+        case ST25R3916_REG_TX_DRIVER_STATUS:
+        case ST25R3916_REG_REGULATOR_RESULT:
+        case ST25R3916_REG_RSSI_RESULT:
+        case ST25R3916_REG_GAIN_RED_STATE:
+        case ST25R3916_REG_CAP_SENSOR_RESULT:
+        case ST25R3916_REG_AUX_DISPLAY:
+        case ST25R3916_REG_AMPLITUDE_MEASURE_REF:         /* updated by the chip when auto averaging is enabled */
+        case ST25R3916_REG_AMPLITUDE_MEASURE_AA_RESULT:
+        case ST25R3916_REG_AMPLITUDE_MEASURE_RESULT:
+        case ST25R3916_REG_PHASE_MEASURE_REF:
+        case ST25R3916_REG_PHASE_MEASURE_AA_RESULT:
+        case ST25R3916_REG_PHASE_MEASURE_RESULT:
+        case ST25R3916_REG_CAPACITANCE_MEASURE_REF:
+        case ST25R3916_REG_CAPACITANCE_MEASURE_AA_RESULT:
+        case ST25R3916_REG_CAPACITANCE_MEASURE_RESULT:
+        case ST25R3916_REG_IC_IDENTITY:
+            return true;
+            
+        default:
+            return ( reg >= ST25R3916_SHADOW_LEN );
+    }
+}
+
+
+/*******************************************************************************/
+static void st25r3916ShadowUpdate( uint8_t reg, const uint8_t* values, uint8_t length, bool write )
+{
+    uint8_t i;
+    uint8_t addr;
+    
+    for( i = 0; i < length; i++ )
+    {
+        /* Register address auto increments within the same space */
+        addr = ((reg & ~ST25R3916_SPACE_B) + i);
+        if( addr >= ST25R3916_SPACE_B )
+        {
+            break;
+        }
+        addr |= (reg & ST25R3916_SPACE_B);
+        
+        if( st25r3916ShadowIsVolatile( addr ) )
+        {
+            /* Never kept on the shadow */
+        }
+        else if( write && st25r3916ShadowRecording() )
+        {
+            /* Value only reaches the ST25R3916 on commit, keep it off the shadow until then */
+            gST25R3916Shadow.staged[addr] = true;
+            gST25R3916Shadow.valid[addr]  = false;
+        }
+        else if( !gST25R3916Shadow.staged[addr] )
+        {
+            gST25R3916Shadow.regs[addr]  = values[i];
+            gST25R3916Shadow.valid[addr] = true;
+        }
+        else
+        {
+            /* A staged write still overrides this value */
+        }
+    }
+}
+
+
+/*******************************************************************************/
+static void st25r3916ShadowTestUpdate( uint8_t reg, uint8_t value, bool write )
+{
+    if( reg >= ST25R3916_SHADOW_TEST_LEN )
+    {
+        return;
+    }
+    
+    if( write && st25r3916ShadowRecording() )
+    {
+        gST25R3916Shadow.testStaged[reg] = true;
+        gST25R3916Shadow.testValid[reg]  = false;
+    }
+    else if( !gST25R3916Shadow.testStaged[reg] )
+    {
+        gST25R3916Shadow.testRegs[reg]  = value;
+        gST25R3916Shadow.testValid[reg] = true;
+    }
+    else
+    {
+        /* A staged write still overrides this value */
+    }
+}
+
+
+#ifdef ST25R3916_COM_STAGE
+/*******************************************************************************/
+static void st25r3916ShadowUnstage( void )
+{
+    ST_MEMSET( gST25R3916Shadow.staged,     0x00, sizeof(gST25R3916Shadow.staged) );
+    ST_MEMSET( gST25R3916Shadow.testStaged, 0x00, sizeof(gST25R3916Shadow.testStaged) );
+}
+#endif /* ST25R3916_COM_STAGE */
+#endif /* ST25R_COM_SHADOW */
+
+
+/*******************************************************************************/
+static ReturnCode st25r3916ReadRegisterShadow( uint8_t reg, uint8_t* val )
+{
+#ifdef ST25R_COM_SHADOW
+    if( (reg < ST25R3916_SHADOW_LEN) && gST25R3916Shadow.valid[reg] )
+    {
+        gST25R3916Shadow.hits++;
+        *val = gST25R3916Shadow.regs[reg];
+        return ERR_NONE;
+    }
+    
+    gST25R3916Shadow.misses++;
+#endif /* ST25R_COM_SHADOW */
+    
+    return st25r3916ReadRegister( reg, val );
+}
+
+
+/*******************************************************************************/
+static ReturnCode st25r3916ReadTestRegisterShadow( uint8_t reg, uint8_t* val )
+{
+#ifdef ST25R_COM_SHADOW
+    if( (reg < ST25R3916_SHADOW_TEST_LEN) && gST25R3916Shadow.testValid[reg] )
+    {
+        gST25R3916Shadow.hits++;
+        *val = gST25R3916Shadow.testRegs[reg];
+        return ERR_NONE;
+    }
+    
+    gST25R3916Shadow.misses++;
+#endif /* ST25R_COM_SHADOW */
+    
+    return st25r3916ReadTestRegister( reg, val );
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -322,6 +692,11 @@ ReturnCode st25r3916ReadMultipleRegisters( uint8_t reg, uint8_t* values, uint8_t
         st25r3916comTxByte( ((reg & ~ST25R3916_SPACE_B) | ST25R3916_READ_MODE), true, false );
         st25r3916comRepeatStart();
         st25r3916comRx( values, length );
+        
+    #ifdef ST25R_COM_SHADOW
+        st25r3916ShadowUpdate( reg, values, length, false );
+    #endif /* ST25R_COM_SHADOW */
+        
         st25r3916comStop();
     }
     
@@ -351,6 +726,11 @@ ReturnCode st25r3916WriteMultipleRegisters( uint8_t reg, const uint8_t* values,
         
         st25r3916comTxByte( ((reg & ~ST25R3916_SPACE_B) | ST25R3916_WRITE_MODE), false, true );
         st25r3916comTx( values, length, true, true );
+        
+    #ifdef ST25R_COM_SHADOW
+        st25r3916ShadowUpdate( reg, values, length, true );
+    #endif /* ST25R_COM_SHADOW */
+        
         st25r3916comStop();
         
         /* Send a WriteMultiReg event to LED handling */
@@ -392,6 +772,9 @@ ReturnCode st25r3916ReadFifo( uint8_t* buf, uint16_t length )
         st25r3916comRepeatStart();
         st25r3916comRx( buf, length );
         st25r3916comStop();
+        
+        /* FIFO status kept by the ISR no longer matches the FIFO content */
+        st25r3916ClearInterruptFifoStatus();
     }
 
     return ERR_NONE;
@@ -490,8 +873,23 @@ ReturnCode st25r3916ExecuteCommand( uint8_t cmd )
 {
     st25r3916comStart();
     st25r3916comTxByte( (cmd | ST25R3916_CMD_MODE ), true, true );
+    
+#ifdef ST25R_COM_SHADOW
+    /* Set Default restores all registers to their default value */
+    if( cmd == ST25R3916_CMD_SET_DEFAULT )
+    {
+        st25r3916ShadowInvalidate();
+    }
+#endif /* ST25R_COM_SHADOW */
+    
     st25r3916comStop();
     
+    /* FIFO status kept by the ISR no longer matches the FIFO content */
+    if( (cmd == ST25R3916_CMD_CLEAR_FIFO) || (cmd == ST25R3916_CMD_STOP) )
+    {
+        st25r3916ClearInterruptFifoStatus();
+    }
+    
     /* Send a cmd event to LED handling */
     st25r3916ledEvtCmd(cmd);
     
@@ -507,6 +905,11 @@ ReturnCode st25r3916ReadTestRegister( uint8_t reg, uint8_t* val )
     st25r3916comTxByte( (reg | ST25R3916_READ_MODE), true, false );
     st25r3916comRepeatStart();
     st25r3916comRx( val, ST25R3916_REG_LEN );
+    
+#ifdef ST25R_COM_SHADOW
+    st25r3916ShadowTestUpdate( reg, *val, false );
+#endif /* ST25R_COM_SHADOW */
+    
     st25r3916comStop();
     
     return ERR_NONE;
@@ -522,6 +925,11 @@ ReturnCode st25r3916WriteTestRegister( uint8_t reg, uint8_t val )
     st25r3916comTxByte( ST25R3916_CMD_TEST_ACCESS, false, true );
     st25r3916comTxByte( (reg | ST25R3916_WRITE_MODE), false, true );
     st25r3916comTx( &value, ST25R3916_REG_LEN, true, true );
+    
+#ifdef ST25R_COM_SHADOW
+    st25r3916ShadowTestUpdate( reg, value, true );
+#endif /* ST25R_COM_SHADOW */
+    
     st25r3916comStop();
     
     return ERR_NONE;
@@ -535,7 +943,7 @@ ReturnCode st25r3916ClrRegisterBits( uint8_t reg, uint8_t clr_mask )
     uint8_t    rdVal;
     
     /* Read current reg value */
-    EXIT_ON_ERR( ret, st25r3916ReadRegister(reg, &rdVal) );
+    EXIT_ON_ERR( ret, st25r3916ReadRegisterShadow(reg, &rdVal) );
     
     /* Only perform a Write if value to be written is different */
     if( ST25R3916_OPTIMIZE && (rdVal == (uint8_t)(rdVal & ~clr_mask)) )
@@ -555,7 +963,7 @@ ReturnCode st25r3916SetRegisterBits( uint8_t reg, uint8_t set_mask )
     uint8_t    rdVal;
     
     /* Read current reg value */
-    EXIT_ON_ERR( ret, st25r3916ReadRegister(reg, &rdVal) );
+    EXIT_ON_ERR( ret, st25r3916ReadRegisterShadow(reg, &rdVal) );
     
     /* Only perform a Write if the value to be written is different */
     if( ST25R3916_OPTIMIZE && (rdVal == (rdVal | set_mask)) )
@@ -583,7 +991,7 @@ ReturnCode st25r3916ModifyRegister( uint8_t reg, uint8_t clr_mask, uint8_t set_m
     uint8_t    wrVal;
     
     /* Read current reg value */
-    EXIT_ON_ERR( ret, st25r3916ReadRegister(reg, &rdVal) );
+    EXIT_ON_ERR( ret, st25r3916ReadRegisterShadow(reg, &rdVal) );
     
     /* Compute new value */
     wrVal  = (uint8_t)(rdVal & ~clr_mask);
@@ -600,6 +1008,90 @@ ReturnCode st25r3916ModifyRegister( uint8_t reg, uint8_t clr_mask, uint8_t set_m
 }
 
 
+/*******************************************************************************/
+ReturnCode st25r3916ChangeMultipleRegisterBits( uint8_t reg, const uint8_t* valueMasks, const uint8_t* values, uint8_t length )
+{
+    ReturnCode ret;
+    uint8_t    rdVals[ST25R3916_SPACE_B];
+    uint8_t    wrVals[ST25R3916_SPACE_B];
+    uint8_t    first;
+    uint8_t    last;
+    uint8_t    i;
+    bool       cached;
+    
+    if( length == 0U )
+    {
+        return ERR_NONE;
+    }
+    
+    /* A multiple register access cannot go across space-A and space-B */
+    if( ((uint16_t)(reg & ~ST25R3916_SPACE_B) + length) > ST25R3916_SPACE_B )
+    {
+        return ERR_PARAM;
+    }
+    
+    /* Read current reg values, from the shadow or all at once */
+    cached = false;
+#ifdef ST25R_COM_SHADOW
+    cached = true;
+    for( i = 0; i < length; i++ )
+    {
+        if( !gST25R3916Shadow.valid[(uint8_t)(reg + i)] )
+        {
+            cached = false;
+            break;
+        }
+    }
+    
+    if( cached )
+    {
+        gST25R3916Shadow.hits += length;
+        ST_MEMCPY( rdVals, &gST25R3916Shadow.regs[reg], length );
+    }
+    else
+    {
+        gST25R3916Shadow.misses++;
+    }
+#endif /* ST25R_COM_SHADOW */
+    
+    if( !cached )
+    {
+        EXIT_ON_ERR( ret, st25r3916ReadMultipleRegisters( reg, rdVals, length ) );
+    }
+    
+    /* Compute new values */
+    for( i = 0; i < length; i++ )
+    {
+        wrVals[i]  = (uint8_t)(rdVals[i] & ~valueMasks[i]);
+        wrVals[i] |= (uint8_t)(values[i] & valueMasks[i]);
+    }
+    
+    /* Only write the registers from the first to the last one whose value is different */
+    first = 0;
+    last  = length;
+    if( ST25R3916_OPTIMIZE )
+    {
+        while( (first < last) && (rdVals[first] == wrVals[first]) )
+        {
+            first++;
+        }
+        
+        while( (last > first) && (rdVals[last - 1U] == wrVals[last - 1U]) )
+        {
+            last--;
+        }
+    }
+    
+    if( first == last )
+    {
+        return ERR_NONE;
+    }
+    
+    /* Write new reg values */
+    return st25r3916WriteMultipleRegisters( (reg + first), &wrVals[first], (last - first) );
+}
+
+
 /*******************************************************************************/
 ReturnCode st25r3916ChangeTestRegisterBits( uint8_t reg, uint8_t valueMask, uint8_t value )
 {
@@ -608,7 +1100,7 @@ ReturnCode st25r3916ChangeTestRegisterBits( uint8_t reg, uint8_t valueMask, uint
     uint8_t    wrVal;
     
     /* Read current reg value */
-    EXIT_ON_ERR( ret, st25r3916ReadTestRegister(reg, &rdVal) );
+    EXIT_ON_ERR( ret, st25r3916ReadTestRegisterShadow(reg, &rdVal) );
     
     /* Compute new value */
     wrVal  = (uint8_t)(rdVal & ~valueMask);
@@ -637,6 +1129,238 @@ bool st25r3916CheckReg( uint8_t reg, uint8_t mask, uint8_t val )
 }
 
 
+/*******************************************************************************/
+void st25r3916ShadowInvalidate( void )
+{
+#ifdef ST25R_COM_SHADOW
+    ST_MEMSET( gST25R3916Shadow.valid,     0x00, sizeof(gST25R3916Shadow.valid) );
+    ST_MEMSET( gST25R3916Shadow.testValid, 0x00, sizeof(gST25R3916Shadow.testValid) );
+#endif /* ST25R_COM_SHADOW */
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916ShadowResync( void )
+{
+#ifdef ST25R_COM_SHADOW
+    uint8_t regs[ST25R3916_SPACE_B];
+    
+    st25r3916ShadowInvalidate();
+    
+    /* Read back all space-A registers skipping the IRQ registers (read clears them) and all space-B registers */
+    st25r3916ReadMultipleRegisters( ST25R3916_REG_IO_CONF1, regs, (ST25R3916_REG_IRQ_MASK_TARGET + 1U) );
+    st25r3916ReadMultipleRegisters( ST25R3916_REG_FIFO_STATUS1, regs, (ST25R3916_SPACE_B - ST25R3916_REG_FIFO_STATUS1) );
+    st25r3916ReadMultipleRegisters( (ST25R3916_SPACE_B | ST25R3916_REG_IO_CONF1), regs, ST25R3916_SPACE_B );
+#endif /* ST25R_COM_SHADOW */
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void st25r3916ShadowGetStats( uint32_t* hits, uint32_t* misses )
+{
+#ifdef ST25R_COM_SHADOW
+    if( hits != NULL )
+    {
+        *hits = gST25R3916Shadow.hits;
+    }
+    
+    if( misses != NULL )
+    {
+        *misses = gST25R3916Shadow.misses;
+    }
+#else
+    if( hits != NULL )
+    {
+        *hits = 0;
+    }
+    
+    if( misses != NULL )
+    {
+        *misses = 0;
+    }
+#endif /* ST25R_COM_SHADOW */
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916BatchStart( void )
+{
+#ifdef ST25R3916_COM_BATCH
+    /* Keep the communication channel for the whole batch */
+    platformProtectST25RComm();
+    
+    if( comBatchOpen || (platformSpiBatchBegin() != HAL_OK) )
+    {
+        platformUnprotectST25RComm();
+        return ERR_WRONG_STATE;
+    }
+    
+    comBatchOpen = true;
+#endif /* ST25R3916_COM_BATCH */
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916BatchEnd( void )
+{
+    ReturnCode ret;
+    
+    ret = ERR_NONE;
+    
+#ifdef ST25R3916_COM_BATCH
+    /* Only the owner of the batch holds the channel lock */
+    platformProtectST25RComm();
+    
+    if( !comBatchOpen )
+    {
+        platformUnprotectST25RComm();
+        return ERR_WRONG_STATE;
+    }
+    
+    if( platformSpiBatchEnd() != HAL_OK )
+    {
+        ret = ERR_IO;
+    }
+    
+    comBatchOpen = false;
+    
+    platformUnprotectST25RComm();               /* balance the lock taken above           */
+    platformUnprotectST25RComm();               /* release the lock taken on BatchStart   */
+#endif /* ST25R3916_COM_BATCH */
+    
+    return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916StageStart( void )
+{
+#ifdef ST25R3916_COM_STAGE
+    ReturnCode ret;
+    
+    ret = ERR_NONE;
+    
+    platformProtectST25RComm();
+    
+    if( gST25R3916Stage.recording || (gST25R3916Stage.len != 0U) )
+    {
+        ret = ERR_WRONG_STATE;
+    }
+    else
+    {
+        gST25R3916Stage.overflow  = false;
+        gST25R3916Stage.recording = true;
+    }
+    
+    platformUnprotectST25RComm();
+    
+    return ret;
+#else
+    return ERR_NOTSUPP;
+#endif /* ST25R3916_COM_STAGE */
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916StageStop( void )
+{
+#ifdef ST25R3916_COM_STAGE
+    ReturnCode ret;
+    
+    platformProtectST25RComm();
+    
+    if( !gST25R3916Stage.recording )
+    {
+        platformUnprotectST25RComm();
+        return ERR_WRONG_STATE;
+    }
+    
+    gST25R3916Stage.recording = false;
+    ret = (gST25R3916Stage.overflow ? ERR_NOMEM : ERR_NONE);
+    
+    platformUnprotectST25RComm();
+    
+    /* An incomplete recording cannot be sent, drop it */
+    if( ret != ERR_NONE )
+    {
+        st25r3916StageDiscard();
+    }
+    
+    return ret;
+#else
+    return ERR_WRONG_STATE;
+#endif /* ST25R3916_COM_STAGE */
+}
+
+
+/*******************************************************************************/
+ReturnCode st25r3916StageCommit( void )
+{
+#ifdef ST25R3916_COM_STAGE
+    uint16_t it;
+    uint16_t length;
+    
+    platformProtectST25RComm();
+    
+    if( gST25R3916Stage.recording )
+    {
+        platformUnprotectST25RComm();
+        return ERR_WRONG_STATE;
+    }
+    
+    /* Replay the frames in the recorded order, within an open batch they are queued on the same transfer */
+    it = 0;
+    while( it < gST25R3916Stage.len )
+    {
+        length  = (uint16_t)((uint16_t)gST25R3916Stage.buf[it] << 8U);
+        length |= (uint16_t)gST25R3916Stage.buf[it + 1U];
+        it     += ST25R3916_STAGE_HDR_LEN;
+        
+        st25r3916comStart();
+        st25r3916comTx( &gST25R3916Stage.buf[it], length, true, true );
+        st25r3916comStop();
+        
+        it += length;
+    }
+    
+    gST25R3916Stage.len = 0;
+    
+    #ifdef ST25R_COM_SHADOW
+    /* Staged registers are on the ST25R3916 now, next read refills them */
+    st25r3916ShadowUnstage();
+    #endif /* ST25R_COM_SHADOW */
+    
+    platformUnprotectST25RComm();
+#endif /* ST25R3916_COM_STAGE */
+    
+    return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void st25r3916StageDiscard( void )
+{
+#ifdef ST25R3916_COM_STAGE
+    platformProtectST25RComm();
+    
+    gST25R3916Stage.recording = false;
+    gST25R3916Stage.overflow  = false;
+    gST25R3916Stage.len       = 0;
+    
+    #ifdef ST25R_COM_SHADOW
+    /* Staged registers were never written, next read refills them with the ST25R3916 values */
+    st25r3916ShadowUnstage();
+    #endif /* ST25R_COM_SHADOW */
+    
+    platformUnprotectST25RComm();
+#endif /* ST25R3916_COM_STAGE */
+}
+
+
 /*******************************************************************************/
 bool st25r3916IsRegValid( uint8_t reg )
 {
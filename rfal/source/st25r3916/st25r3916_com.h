@@ -1268,6 +1268,27 @@ ReturnCode st25r3916ChangeRegisterBits( uint8_t reg, uint8_t valueMask, uint8_t
  */
 ReturnCode st25r3916ModifyRegister( uint8_t reg, uint8_t clr_mask, uint8_t set_mask );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Changes the given bits on consecutive ST25R3916 registers
+ *
+ *  This function changes the masked bits of several consecutive registers.
+ *  The current values are taken from the register shadow when available,
+ *  otherwise all registers are read at once, and the new values are sent 
+ *  with a single multiple register write.
+ *
+ *  \param[in]  reg: Address of the first register to change.
+ *  \param[in]  valueMasks: bitmask of bits to be changed, one per register
+ *  \param[in]  values: the bits to be written on the enabled valueMasks bits
+ *  \param[in]  length: number of registers to change
+ *
+ *  \return ERR_NONE  : Operation successful
+ *  \return ERR_PARAM : Invalid parameter, registers not all on the same space
+ *  \return ERR_SEND  : Transmission error or acknowledge not received
+ *****************************************************************************
+ */
+ReturnCode st25r3916ChangeMultipleRegisterBits( uint8_t reg, const uint8_t* valueMasks, const uint8_t* values, uint8_t length );
+
 /*! 
  *****************************************************************************
  *  \brief  Changes the given bits on a ST25R3916 Test register
@@ -1316,6 +1337,145 @@ bool st25r3916CheckReg( uint8_t reg, uint8_t mask, uint8_t val );
  */
 bool st25r3916IsRegValid( uint8_t reg );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Invalidate the register shadow
+ *
+ *  Marks all register values kept on the shadow as unknown, the following
+ *  read-modify-write operations read the registers from the ST25R3916.
+ *  Must be called whenever the ST25R3916 registers may have changed without 
+ *  the driver's knowledge (e.g. power loss or reset). 
+ *  Set Default command invalidates the shadow automatically.
+ *
+ *****************************************************************************
+ */
+void st25r3916ShadowInvalidate( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Resynchronize the register shadow
+ *
+ *  Invalidates the shadow and reloads it by reading back all ST25R3916
+ *  config registers. Interrupt registers are not read.
+ *  Test registers are reloaded on their next access.
+ *
+ *  \return  ERR_NONE : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916ShadowResync( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Get register shadow statistics
+ *
+ *  Retrieves the number of read-modify-write reads served from the shadow 
+ *  (hits) and the ones that required a bus access (misses).
+ *  Both are zero when the shadow is disabled (ST25R_COM_SHADOW)
+ *
+ *  \param[out]  hits   : reads served from the shadow, NULL if not needed
+ *  \param[out]  misses : reads performed on the bus, NULL if not needed
+ *
+ *****************************************************************************
+ */
+void st25r3916ShadowGetStats( uint32_t* hits, uint32_t* misses );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Start a communication batch
+ *
+ *  Opens a batch on which the following register, FIFO and command writes 
+ *  are queued and sent to the ST25R3916 in a single SPI transfer, saving 
+ *  one system call per access.
+ *  Reads flush the queued accesses together with the read itself so that 
+ *  their value is available on return.
+ *  The communication channel is kept protected until st25r3916BatchEnd().
+ *
+ *  On platforms/configurations without batch support this is a no-op and 
+ *  every access is performed immediately.
+ *
+ *  \return  ERR_WRONG_STATE : A batch is already open or cannot be started
+ *  \return  ERR_NONE        : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916BatchStart( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  End a communication batch
+ *
+ *  Sends all accesses queued since st25r3916BatchStart() and releases the 
+ *  communication channel
+ *
+ *  \return  ERR_WRONG_STATE : No batch open
+ *  \return  ERR_IO          : Error during communication
+ *  \return  ERR_NONE        : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916BatchEnd( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Start recording write accesses
+ *
+ *  The following register, FIFO and command writes are not sent but 
+ *  recorded, so that a sequence can be prepared ahead and sent with the 
+ *  least latency by st25r3916StageCommit(). Reads are performed immediately.
+ *  The register shadow never holds recorded values: registers written are 
+ *  read from the ST25R3916 until the recording is sent or discarded.
+ *
+ *  Only the thread driving the ST25R3916 may write while recording.
+ *
+ *  \return  ERR_NOTSUPP     : Recording not supported on this configuration
+ *  \return  ERR_WRONG_STATE : Already recording or recorded writes pending
+ *  \return  ERR_NONE        : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916StageStart( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Stop recording write accesses
+ *
+ *  The recorded writes are kept until st25r3916StageCommit() or 
+ *  st25r3916StageDiscard(), following writes are sent immediately again.
+ *
+ *  \return  ERR_WRONG_STATE : Not recording
+ *  \return  ERR_NOMEM       : The writes did not fit and were discarded
+ *  \return  ERR_NONE        : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916StageStop( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Send the recorded write accesses
+ *
+ *  Sends the recorded writes in their original order. Within a batch 
+ *  (st25r3916BatchStart()) they are sent on a single SPI transfer.
+ *
+ *  \return  ERR_WRONG_STATE : Still recording
+ *  \return  ERR_NONE        : No error
+ *
+ *****************************************************************************
+ */
+ReturnCode st25r3916StageCommit( void );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Discard the recorded write accesses
+ *
+ *  Drops the recorded writes without sending them. The registers they 
+ *  would have written are refilled on the shadow by the next read.
+ *
+ *****************************************************************************
+ */
+void st25r3916StageDiscard( void );
+
 #endif /* ST25R3916_COM_H */
 
 
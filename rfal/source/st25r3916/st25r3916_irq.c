@@ -47,6 +47,10 @@
 #include "st25r3916.h"
 #include "utils.h"
 
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+#include <stdatomic.h>
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
+
 /*
  ******************************************************************************
  * LOCAL DATA TYPES
@@ -58,8 +62,15 @@ typedef struct
 {
     void      (*prevCallback)(void); /*!< call back function for ST25R3916 interrupt          */
     void      (*callback)(void);     /*!< call back function for ST25R3916 interrupt          */
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+    _Atomic uint32_t status;         /*!< latest interrupt status                             */
+#else
     uint32_t  status;                /*!< latest interrupt status                             */
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
     uint32_t  mask;                  /*!< Interrupt mask. Negative mask = ST25R3916 mask regs */
+    uint8_t   fifoStatus[ST25R3916_FIFO_STATUS_LEN]; /*!< FIFO status read along with RXE|FWL */
+    bool      fifoStatusValid;       /*!< FIFO status read along with RXE|FWL is available    */
+    uint32_t  fifoGen;               /*!< FIFO generation, moves on each FIFO read or clear   */
 } st25r3916Interrupt;
 
 
@@ -72,13 +83,33 @@ typedef struct
 /*! Length of the interrupt registers       */
 #define ST25R3916_INT_REGS_LEN          ( (ST25R3916_REG_IRQ_TARGET - ST25R3916_REG_IRQ_MAIN) + 1U )
 
+/*! Length of the interrupt registers followed by the FIFO status registers */
+#define ST25R3916_INT_FIFO_REGS_LEN     ( (ST25R3916_REG_FIFO_STATUS2 - ST25R3916_REG_IRQ_MAIN) + 1U )
+
+/*
+******************************************************************************
+* LOCAL MACROS
+******************************************************************************
+*/
+
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+    /* ISR and consumers update the status word atomically, no lock required */
+    #define st25r3916IrqStatusGet()          atomic_load_explicit( &st25r3916interrupt.status, memory_order_acquire )                            /*!< Read the interrupt status                          */
+    #define st25r3916IrqStatusSet( irqs )    atomic_fetch_or_explicit( &st25r3916interrupt.status, (irqs), memory_order_acq_rel )                /*!< Add interrupts to the status, returns previous     */
+    #define st25r3916IrqStatusClr( irqs )    atomic_fetch_and_explicit( &st25r3916interrupt.status, ~(uint32_t)(irqs), memory_order_acq_rel )    /*!< Remove interrupts from the status, returns previous */
+    #define st25r3916IrqStatusReset()        atomic_store_explicit( &st25r3916interrupt.status, ST25R3916_IRQ_MASK_NONE, memory_order_release )  /*!< Clear the interrupt status                         */
+#else
+    #define st25r3916IrqStatusGet()          (st25r3916interrupt.status)
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
+
 /*
 ******************************************************************************
 * GLOBAL VARIABLES
 ******************************************************************************
 */
 
-static volatile st25r3916Interrupt   st25r3916interrupt; /*!< Instance of ST25R3916 interrupt */
+static volatile st25r3916Interrupt   st25r3916interruptInst[ST25R_MAX_INSTANCES]; /*!< Instances of ST25R3916 interrupt, one per ST25R3916 */
+#define st25r3916interrupt    (st25r3916interruptInst[platformGetInstance()])     /*!< Instance of ST25R3916 interrupt of the caller        */
 
 /*
 ******************************************************************************
@@ -93,8 +124,14 @@ void st25r3916InitInterrupts( void )
     
     st25r3916interrupt.callback     = NULL;
     st25r3916interrupt.prevCallback = NULL;
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+    st25r3916IrqStatusReset();
+#else
     st25r3916interrupt.status       = ST25R3916_IRQ_MASK_NONE;
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
     st25r3916interrupt.mask         = ST25R3916_IRQ_MASK_NONE;
+    st25r3916interrupt.fifoStatusValid = false;
+    st25r3916interrupt.fifoGen         = 0;
 }
 
 
@@ -114,32 +151,62 @@ void st25r3916Isr( void )
 /*******************************************************************************/
 void st25r3916CheckForReceivedInterrupts( void )
 {
-    uint8_t  iregs[ST25R3916_INT_REGS_LEN];
+    uint8_t  iregs[ST25R3916_INT_FIFO_REGS_LEN];
     uint32_t irqStatus;
+    bool     fifoRead;
+    uint32_t fifoGen;
     
     /* Initialize iregs */
     irqStatus = ST25R3916_IRQ_MASK_NONE;
-    ST_MEMSET( iregs, (int32_t)(ST25R3916_IRQ_MASK_ALL & 0xFFU), ST25R3916_INT_REGS_LEN );
+    ST_MEMSET( iregs, (int32_t)(ST25R3916_IRQ_MASK_ALL & 0xFFU), ST25R3916_INT_FIFO_REGS_LEN );
     
     
     /* In case the IRQ is Edge (not Level) triggered read IRQs until done */
    while( platformGpioIsHigh( ST25R_INT_PORT, ST25R_INT_PIN ) )
    {
-       st25r3916ReadMultipleRegisters( ST25R3916_REG_IRQ_MAIN, iregs, ST25R3916_INT_REGS_LEN );
+       /* When RXE is enabled read the FIFO status on the same transaction as well */
+       fifoRead = ((st25r3916interrupt.mask & ST25R3916_IRQ_MASK_RXE) == 0U);
+       
+       /* Tag the FIFO status with the FIFO generation before reading it */
+       platformProtectST25RIrqStatus();
+       fifoGen = st25r3916interrupt.fifoGen;
+       platformUnprotectST25RIrqStatus();
+       
+       st25r3916ReadMultipleRegisters( ST25R3916_REG_IRQ_MAIN, iregs, (fifoRead ? ST25R3916_INT_FIFO_REGS_LEN : ST25R3916_INT_REGS_LEN) );
        
        irqStatus |= (uint32_t)iregs[0];
        irqStatus |= (uint32_t)iregs[1]<<8;
        irqStatus |= (uint32_t)iregs[2]<<16;
        irqStatus |= (uint32_t)iregs[3]<<24;
+       
+       /* Reception ended, FIFO status is final: keep it for the RX completion.      *
+        * On a WL interrupt keep it as well so the FIFO can be drained at once.      *
+        * If the FIFO has been read or cleared meanwhile the status is stale, drop it */
+       if( fifoRead && (((uint32_t)iregs[0] & (ST25R3916_IRQ_MASK_RXE | ST25R3916_IRQ_MASK_FWL)) != 0U) )
+       {
+           platformProtectST25RIrqStatus();
+           if( fifoGen == st25r3916interrupt.fifoGen )
+           {
+               st25r3916interrupt.fifoStatus[0]   = iregs[ST25R3916_INT_REGS_LEN];
+               st25r3916interrupt.fifoStatus[1]   = iregs[ST25R3916_INT_REGS_LEN + 1U];
+               st25r3916interrupt.fifoStatusValid = true;
+           }
+           platformUnprotectST25RIrqStatus();
+       }
    }
    
    /* Forward all interrupts, even masked ones to application */
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+   irqStatus |= st25r3916IrqStatusSet( irqStatus );
+#else
    platformProtectST25RIrqStatus();
    st25r3916interrupt.status |= irqStatus;
+   irqStatus = st25r3916interrupt.status;
    platformUnprotectST25RIrqStatus();
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
    
    /* Send an IRQ event to LED handling */
-   st25r3916ledEvtIrq( st25r3916interrupt.status );
+   st25r3916ledEvtIrq( irqStatus );
 }
 
 
@@ -172,24 +239,44 @@ void st25r3916ModifyInterrupts(uint32_t clr_mask, uint32_t set_mask)
 /*******************************************************************************/
 uint32_t st25r3916WaitForInterruptsTimed( uint32_t mask, uint16_t tmo )
 {
-    uint32_t tmrDelay;
     uint32_t status;
     
+#ifdef platformIrqEventWait
+    uint64_t deadline;
+    uint32_t seq;
+    
+    deadline = platformIrqEventDeadline( tmo );
+    
+    /* Sleep until specific interrupt has happen or the deadline is reached */
+    do
+    {
+        seq    = platformIrqEventGet();
+        status = (st25r3916IrqStatusGet() & mask);
+    } while( (status == 0U) && platformIrqEventWait( seq, deadline ) );
+    
+#else
+    uint32_t tmrDelay;
+    
     tmrDelay = platformTimerCreate( tmo );
     
     /* Run until specific interrupt has happen or the timer has expired */
     do 
     {
-        status = (st25r3916interrupt.status & mask);
+        status = (st25r3916IrqStatusGet() & mask);
     } while( ( !platformTimerIsExpired( tmrDelay ) || (tmo == 0U)) && (status == 0U) );
     
     platformTimerDestroy( tmrDelay );
+#endif /* platformIrqEventWait */
 
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+    status = (st25r3916IrqStatusClr( mask ) & mask);
+#else
     status = st25r3916interrupt.status & mask;
     
     platformProtectST25RIrqStatus();
     st25r3916interrupt.status &= ~status;
     platformUnprotectST25RIrqStatus();
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
     
     return status;
 }
@@ -200,12 +287,17 @@ uint32_t st25r3916GetInterrupt( uint32_t mask )
 {
     uint32_t irqs;
 
-    irqs = (st25r3916interrupt.status & mask);
+    irqs = (st25r3916IrqStatusGet() & mask);
     if(irqs != ST25R3916_IRQ_MASK_NONE)
     {
+    #ifdef ST25R_IRQ_STATUS_ATOMIC
+        /* Take the ones set meanwhile as well */
+        irqs = (st25r3916IrqStatusClr( mask ) & mask);
+    #else
         platformProtectST25RIrqStatus();
         st25r3916interrupt.status &= ~irqs;
         platformUnprotectST25RIrqStatus();
+    #endif /* ST25R_IRQ_STATUS_ATOMIC */
     }
 
     return irqs;
@@ -240,12 +332,45 @@ void st25r3916ClearInterrupts( void )
 
     st25r3916ReadMultipleRegisters(ST25R3916_REG_IRQ_MAIN, iregs, ST25R3916_INT_REGS_LEN);
 
+#ifdef ST25R_IRQ_STATUS_ATOMIC
+    st25r3916IrqStatusReset();
+#else
     platformProtectST25RIrqStatus();
     st25r3916interrupt.status = ST25R3916_IRQ_MASK_NONE;
     platformUnprotectST25RIrqStatus();
+#endif /* ST25R_IRQ_STATUS_ATOMIC */
     return;
 }
 
+/*******************************************************************************/
+bool st25r3916GetInterruptFifoStatus( uint8_t* fifoStatus )
+{
+    bool valid;
+    
+    platformProtectST25RIrqStatus();
+    valid = st25r3916interrupt.fifoStatusValid;
+    if( valid )
+    {
+        fifoStatus[0] = st25r3916interrupt.fifoStatus[0];
+        fifoStatus[1] = st25r3916interrupt.fifoStatus[1];
+        st25r3916interrupt.fifoStatusValid = false;
+    }
+    platformUnprotectST25RIrqStatus();
+    
+    return valid;
+}
+
+
+/*******************************************************************************/
+void st25r3916ClearInterruptFifoStatus( void )
+{
+    platformProtectST25RIrqStatus();
+    st25r3916interrupt.fifoStatusValid = false;
+    st25r3916interrupt.fifoGen++;
+    platformUnprotectST25RIrqStatus();
+}
+
+
 /*******************************************************************************/
 void st25r3916IRQCallbackSet( void (*cb)(void) )
 {
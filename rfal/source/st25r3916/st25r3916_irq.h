@@ -226,6 +226,36 @@ void st25r3916DisableInterrupts( uint32_t mask );
  */
 void st25r3916ClearInterrupts( void );
 
+/*! 
+ *****************************************************************************
+ *  \brief  Get the FIFO status read along with RXE or FWL
+ *
+ *  When RXE is enabled the ISR reads the FIFO status registers on the same
+ *  transaction as the interrupt registers. Once reception has ended this 
+ *  status is final and can be used instead of reading the FIFO status 
+ *  registers again. On a water level interrupt it holds the FIFO level 
+ *  at the time of the interrupt. The status is consumed by this call.
+ *
+ *  \param[out] fifoStatus : FIFO Status Register 1 and 2
+ *
+ *  \return true if a FIFO status read along with RXE or FWL was available
+ *
+ *****************************************************************************
+ */
+bool st25r3916GetInterruptFifoStatus( uint8_t* fifoStatus );
+
+/*! 
+ *****************************************************************************
+ *  \brief  Discard the FIFO status read along with RXE or FWL
+ *
+ *  Must be called whenever the FIFO content changes (e.g. FIFO read or 
+ *  cleared) as the kept status is no longer accurate. A FIFO status the
+ *  ISR read before this call is not kept afterwards.
+ *
+ *****************************************************************************
+ */
+void st25r3916ClearInterruptFifoStatus( void );
+
 /*! 
  *****************************************************************************
  *  \brief  Clears and then enables the given ST25R3916 Interrupt sources
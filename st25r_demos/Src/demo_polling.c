@@ -182,6 +182,8 @@ bool demoIni( void )
     err = rfalNfcInitialize();
     if( err == ERR_NONE )
     {
+        rfalNfcDefaultDiscParams( &discParam );
+        
         discParam.compMode      = RFAL_COMPLIANCE_MODE_NFC;
         discParam.devLimit      = 1U;
         discParam.nfcfBR        = RFAL_BR_212;